@@ -0,0 +1,47 @@
+#pragma once
+
+#include <oraker/luma.hpp>
+#include <oraker/text_reader.hpp>
+
+#include <opencv2/core.hpp>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace oraker {
+
+// Reads chip amounts (stacks, pot, bets) rendered in Poker Now's font, e.g. "1,250", "12.5", "3.2k", "1M".
+class AmountReader {
+public:
+    static constexpr auto ALPHABET = std::string_view{"0123456789.,kMB"};
+    static constexpr auto FRAME_FORMATS = FrameFormats{.luma = true};
+
+    using Options = TextReader::Options;
+
+    struct Result {
+        std::string text;
+        std::optional<double> value;
+        double confidence = 0.0;
+    };
+
+    explicit AmountReader(Options options);
+
+    // Glyph sets are stored as glyph_<character code>.png plus reader.yml.
+    static auto load(std::filesystem::path const& directory) -> AmountReader;
+    auto save(std::filesystem::path const& directory) const -> void;
+
+    // Adds the field's glyphs to the glyph set, returns false when segmentation disagrees with the label.
+    auto learn(cv::Mat const& field, std::string_view text) -> bool;
+    auto read(cv::Mat const& field) const -> Result;
+
+private:
+    explicit AmountReader(TextReader text);
+
+    TextReader text_;
+};
+
+// Parses "1,250", "12.5", "3.2k" or "1M" into a chip count; thousands separators are ignored.
+auto parseAmount(std::string_view text) -> std::optional<double>;
+
+} // namespace oraker
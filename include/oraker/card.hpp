@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace oraker {
+
+// Playing card packed into one byte as rank * 4 + suit; ranks run from deuce (0) to ace (12).
+class Card {
+public:
+    static constexpr auto RANKS = std::string_view{"23456789TJQKA"};
+    static constexpr auto SUITS = std::string_view{"cdhs"};
+    static constexpr auto COUNT = 52;
+
+    constexpr Card() = default;
+    constexpr Card(int rank, int suit)
+        : index_{static_cast<std::uint8_t>(rank * 4 + suit)} {
+    }
+
+    static constexpr auto fromIndex(int index) { return Card{index / 4, index % 4}; }
+
+    // Accepts "Ah", "Td", "10d" and upper case suits, which covers common detector class names.
+    static constexpr auto parse(std::string_view text) -> std::optional<Card> {
+        auto const isTen = text.size() == 3 && text.starts_with("10");
+        if (text.size() != 2 && !isTen) {
+            return std::nullopt;
+        }
+        auto const rank = RANKS.find(isTen ? 'T' : toUpper(text[0]));
+        auto const suit = SUITS.find(toLower(text.back()));
+        if (rank == std::string_view::npos || suit == std::string_view::npos) {
+            return std::nullopt;
+        }
+        return Card{static_cast<int>(rank), static_cast<int>(suit)};
+    }
+
+    constexpr auto index() const { return static_cast<int>(index_); }
+    constexpr auto rank() const { return static_cast<int>(index_ / 4); }
+    constexpr auto suit() const { return static_cast<int>(index_ % 4); }
+
+    // Bit of the card in a 64-bit hand mask with one 16-bit lane per suit.
+    constexpr auto mask() const { return std::uint64_t{1} << (suit() * 16 + rank()); }
+
+    auto toString() const { return std::string{RANKS[rank()], SUITS[suit()]}; }
+
+    constexpr auto operator<=>(Card const&) const = default;
+
+private:
+    static constexpr auto toUpper(char c) -> char { return c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c; }
+    static constexpr auto toLower(char c) -> char { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; }
+
+    std::uint8_t index_ = 0;
+};
+
+} // namespace oraker
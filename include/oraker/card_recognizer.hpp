@@ -0,0 +1,102 @@
+#pragma once
+
+#include <oraker/card.hpp>
+#include <oraker/detector.hpp>
+#include <oraker/luma.hpp>
+
+#include <opencv2/core.hpp>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace oraker {
+
+// Set of same-sized glyph templates stored as zero-mean, unit-norm rows, so normalised cross-correlation
+// against every template is one matrix-vector product through OpenCV's vectorised GEMM.
+class GlyphAtlas {
+public:
+    struct Match {
+        int label = -1;
+        double score = -1.0;
+        double margin = 0.0;
+    };
+
+    explicit GlyphAtlas(cv::Size glyphSize);
+
+    // Averages every sample seen for a label into its template.
+    auto addSample(int label, cv::Mat const& glyph) -> void;
+    auto match(cv::Mat const& glyph) const -> Match;
+
+    auto empty() const { return labels_.empty(); }
+    auto glyphSize() const { return glyphSize_; }
+    auto labels() const -> std::vector<int> const& { return labels_; }
+    // Template of a label rescaled to 8 bits, for persisting and inspection.
+    auto templateImage(int label) const -> cv::Mat;
+
+private:
+    auto normalise(cv::Mat const& glyph) const -> cv::Mat;
+
+    cv::Size glyphSize_;
+    std::vector<int> labels_;
+    std::vector<cv::Mat> sums_;
+    std::vector<int> counts_;
+    cv::Mat templates_;
+};
+
+// Glyph boxes inside a card ROI as fractions of its size, so one layout serves every window size.
+struct CardGlyphLayout {
+    cv::Rect2f rank{0.04f, 0.02f, 0.42f, 0.36f};
+    cv::Rect2f suit{0.04f, 0.38f, 0.42f, 0.30f};
+};
+
+// Reads Poker Now cards by matching the fixed-font rank and suit glyphs against a learned atlas.
+// Costs microseconds per card; results below the confidence thresholds carry no card so callers can
+// fall back to the detector.
+class CardRecognizer {
+public:
+    static constexpr auto FRAME_FORMATS = FrameFormats{.luma = true};
+
+    struct Options {
+        CardGlyphLayout layout;
+        cv::Size glyphSize{24, 32};
+        double minScore = 0.85;
+        double minMargin = 0.05;
+    };
+
+    struct Result {
+        std::optional<Card> card;
+        double confidence = 0.0;
+    };
+
+    explicit CardRecognizer(Options options);
+
+    // Atlas directories hold rank_<R>.png, suit_<s>.png and layout.yml.
+    static auto load(std::filesystem::path const& directory) -> CardRecognizer;
+    auto save(std::filesystem::path const& directory) const -> void;
+
+    auto learn(cv::Mat const& cardRoi, Card card) -> void;
+    auto recognize(cv::Mat const& cardRoi) const -> Result;
+
+    template<typename Fallback>
+    auto recognize(cv::Mat const& cardRoi, Fallback&& fallback) const -> Result {
+        auto result = recognize(cardRoi);
+        if (!result.card) {
+            result = {fallback(cardRoi), 0.0};
+        }
+        return result;
+    }
+
+    auto options() const -> Options const& { return options_; }
+
+private:
+    Options options_;
+    GlyphAtlas ranks_;
+    GlyphAtlas suits_;
+};
+
+// Slow path: runs the detector on the card ROI at native scale and keeps its most confident card class.
+auto detectCard(Detector& detector, cv::Mat const& cardRoi, std::span<std::string const> classNames) -> std::optional<Card>;
+
+} // namespace oraker
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <oraker/detector.hpp>
+
+#include <opencv2/core.hpp>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace oraker {
+
+struct GroundTruth {
+    cv::Rect2f box;
+    int classId = -1;
+};
+
+// Accumulates predictions over a dataset and computes COCO-style average precision
+// (101-point interpolation) at IoU thresholds 0.50:0.05:0.95, averaged over classes present in the labels.
+class DetectionMetrics {
+public:
+    static constexpr auto IOU_THRESHOLDS = std::size_t{10};
+
+    explicit DetectionMetrics(int classCount);
+
+    auto addImage(std::span<Detection const> predictions, std::span<GroundTruth const> truths) -> void;
+
+    auto averagePrecision(int classId, std::size_t thresholdIndex) const -> double;
+    auto meanAveragePrecision50() const -> double;
+    auto meanAveragePrecision50To95() const -> double;
+
+private:
+    struct Prediction {
+        float confidence = 0.0f;
+        std::array<bool, IOU_THRESHOLDS> truePositive{};
+    };
+
+    std::vector<std::vector<Prediction>> predictions_;
+    std::vector<std::size_t> truthCounts_;
+};
+
+auto iouThreshold(std::size_t thresholdIndex) -> float;
+
+} // namespace oraker
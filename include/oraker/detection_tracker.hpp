@@ -0,0 +1,83 @@
+#pragma once
+
+#include <oraker/detector.hpp>
+#include <oraker/luma.hpp>
+
+#include <opencv2/core.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace oraker {
+
+// Carries detections forward between frames. Every tracked box keeps a small luma thumbnail of its
+// pixels, together with a coarse thumbnail of the whole frame; detection is re-run only when one of
+// them changes or the refresh interval expires, otherwise the previous detections are reused.
+class DetectionTracker {
+public:
+    // Of the view change detection reads, the frame handed to detection is the detector's concern.
+    static constexpr auto FRAME_FORMATS = FrameFormats{.luma = true};
+
+    struct Options {
+        int refreshInterval = 30;
+        double changeThreshold = 6.0;
+        float matchIou = 0.5f;
+        cv::Size thumbnailSize{16, 16};
+        cv::Size frameThumbnailSize{64, 40};
+    };
+
+    struct Track {
+        int id = 0;
+        Detection detection;
+        cv::Mat appearance;
+        int age = 0;
+    };
+
+    struct Statistics {
+        std::size_t frames = 0;
+        std::size_t skipped = 0;
+
+        auto skippedFraction() const { return frames == 0 ? 0.0 : static_cast<double>(skipped) / frames; }
+    };
+
+    explicit DetectionTracker(Options options);
+
+    template<typename Detect>
+    auto process(cv::Mat const& frame, Detect&& detect) -> std::vector<Detection> {
+        return process(frame, frame, detect);
+    }
+
+    // Change detection reads the reduced copy of the frame, detection still runs on the native one.
+    template<typename Detect>
+    auto process(cv::Mat const& frame, cv::Mat const& reduced, Detect&& detect) -> std::vector<Detection> {
+        ++statistics_.frames;
+        if (needsDetection(reduced, frame.size())) {
+            update(reduced, frame.size(), detect(frame));
+        } else {
+            ++statistics_.skipped;
+            ++framesSinceDetection_;
+        }
+        return detections();
+    }
+
+    // The view is the frame itself or a reduced copy of it, detection boxes are in frameSize coordinates.
+    auto needsDetection(cv::Mat const& view, cv::Size frameSize) -> bool;
+    auto update(cv::Mat const& view, cv::Size frameSize, std::vector<Detection> const& detections) -> void;
+
+    auto detections() const -> std::vector<Detection>;
+    auto tracks() const -> std::vector<Track> const& { return tracks_; }
+    auto statistics() const -> Statistics const& { return statistics_; }
+
+private:
+    auto thumbnail(cv::Mat const& view, cv::Rect2f const& box, cv::Size size) const -> cv::Mat;
+
+    Options options_;
+    std::vector<Track> tracks_;
+    cv::Size frameSize_;
+    cv::Size viewSize_;
+    cv::Mat frameAppearance_;
+    int framesSinceDetection_ = 0;
+    int nextId_ = 0;
+    Statistics statistics_;
+};
+
+} // namespace oraker
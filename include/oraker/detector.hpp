@@ -0,0 +1,66 @@
+#pragma once
+
+#include <oraker/luma.hpp>
+
+#include <opencv2/core.hpp>
+#include <opencv2/dnn.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace oraker {
+
+struct Detection {
+    cv::Rect2f box;
+    int classId = -1;
+    float confidence = 0.0f;
+};
+
+// YOLOv8 detector exported to ONNX (`yolo mode=export format=onnx`), run through OpenCV DNN.
+// Batched inference requires the model to be exported with `dynamic=True`; otherwise keep maxBatch at 1.
+class Detector {
+public:
+    static constexpr auto FRAME_FORMATS = FrameFormats{.bgr = true};
+
+    struct Options {
+        std::filesystem::path modelPath;
+        cv::Size inputSize{640, 640};
+        float confidenceThreshold = 0.25f;
+        float nmsThreshold = 0.45f;
+        int maxBatch = 1;
+    };
+
+    // Maps options.modelPath into memory and parses the network from the mapping.
+    explicit Detector(Options options);
+    // Parses the network from an in-memory ONNX model, the buffer is only needed during construction.
+    Detector(Options options, std::span<std::byte const> model);
+
+    // Runs one inference on a synthetic frame so lazy allocations and kernel setup happen before the first real frame.
+    auto warmUp() -> void;
+
+    // Letterboxes the whole frame into the network input, boxes are returned in frame coordinates.
+    auto detect(cv::Mat const& frame) -> std::vector<Detection>;
+
+    // Runs tiles no larger than inputSize at native scale (padded, never resized),
+    // boxes are returned in tile coordinates and are not suppressed across tiles.
+    auto detectTiles(std::span<cv::Mat const> tiles) -> std::vector<std::vector<Detection>>;
+
+    auto options() const -> Options const& { return options_; }
+
+private:
+    auto forward(std::span<cv::Mat const> inputs) -> std::vector<std::vector<Detection>>;
+
+    Options options_;
+    cv::dnn::Net net_;
+};
+
+auto intersectionOverUnion(cv::Rect2f const& lhs, cv::Rect2f const& rhs) -> float;
+
+// Class-aware non-maximum suppression, keeps the most confident box of every overlapping group.
+auto suppressOverlaps(std::vector<Detection> detections, float iouThreshold) -> std::vector<Detection>;
+
+auto loadClassNames(std::filesystem::path const& path) -> std::vector<std::string>;
+
+} // namespace oraker
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <oraker/card.hpp>
+#include <oraker/hand_evaluator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace oraker {
+
+enum class StraightDraw : std::uint8_t {
+    NONE,
+    GUTSHOT,
+    // Two or more ranks complete the straight, open-ended and double gutshots alike.
+    OPEN_ENDED,
+};
+
+// Hero's made hand, outs and draws on a flop or turn.
+struct DrawAnalysis {
+    HandValue made = 0;
+    // Next cards that lift hero to a better category than now and than the board alone plays, so cards
+    // that only improve the board do not count.
+    CardMask outs = 0;
+    int outCount = 0;
+    // Outs by the category they make.
+    std::array<int, 9> outsByCategory{};
+
+    // Draws only count toward a better category than hero already holds.
+    bool flushDraw = false;
+    // Hero holds the highest card of the suit still out, so a completed flush is the nut flush.
+    bool nutFlushDraw = false;
+    // Three to a flush with two cards to come, holding at least one of them.
+    bool backdoorFlushDraw = false;
+    StraightDraw straightDraw = StraightDraw::NONE;
+    // Every rank completing hero's straight makes the best straight possible on that board.
+    bool nutStraightDraw = false;
+
+    auto comboDraw() const { return flushDraw && straightDraw != StraightDraw::NONE; }
+};
+
+// Classifies hero's draws from rank and suit patterns: straights come from tables over every 13-bit
+// rank set built at compile time, flushes from per-suit counts. Outs are found by evaluating each of the
+// at most 47 next cards. Takes two hole cards and a three or four card board; throws on anything else
+// or on duplicate cards. Runs in a few microseconds.
+auto analyzeDraws(std::span<Card const> hole, std::span<Card const> board) -> DrawAnalysis;
+
+// Hero's share against one random hand on the board after each possible next card, indexed by
+// Card::index() and -1 for cards already dealt. Villain hands are evaluated in SIMD batches. The next
+// card after the turn completes the board, so the shares are exact river equities; after the flop they
+// are hand strength on the turn without the river to come. Takes the same input as analyzeDraws().
+auto nextCardEquity(std::span<Card const> hole, std::span<Card const> board) -> std::array<float, Card::COUNT>;
+
+} // namespace oraker
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <oraker/card.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+
+namespace oraker {
+
+// Hero's share of the pot, ties split evenly between the tied hands.
+struct Equity {
+    double equity = 0.0;
+    double win = 0.0;
+    double tie = 0.0;
+    // Half width of the confidence interval around equity, 0 when exact.
+    double halfWidth = 0.0;
+    std::uint64_t hands = 0;
+    double seconds = 0.0;
+    int threads = 1;
+
+    auto handsPerSecondPerCore() const { return seconds > 0.0 ? static_cast<double>(hands) / seconds / threads : 0.0; }
+};
+
+// Estimates hero's equity against opponents holding random hands by dealing random runouts, in Hold'em or,
+// given four or five hole cards, in Omaha where opponents get as many cards as hero. Hands are
+// simulated in fixed-size batches that threads claim from a shared counter; batch i always draws from
+// stream i of the seed, and the stopping rule is only checked between rounds of batches, so a seed gives
+// the same result on any number of threads unless the time budget cuts a run short.
+class MonteCarloEquity {
+public:
+    struct Options {
+        // 0 uses every hardware thread.
+        int threads = 0;
+        std::uint64_t seed = 1;
+        // Stops once the confidence interval is narrower than this, 0 always runs maxHands.
+        double confidenceWidth = 0.01;
+        // Normal quantile of the interval, 1.96 for 95%.
+        double z = 1.96;
+        std::uint64_t minHands = 16'384;
+        // Rounded up to whole batches.
+        std::uint64_t maxHands = 10'000'000;
+        int batchHands = 4'096;
+        // Stops after the round that exceeds it, 0 for no limit.
+        std::chrono::microseconds budget{0};
+    };
+
+    explicit MonteCarloEquity(Options options);
+
+    // Takes hero's two (Hold'em), four or five (Omaha) hole cards and zero to five board cards; throws on
+    // duplicate cards, on fewer than one or more than nine opponents and when the deck runs out of cards.
+    auto estimate(std::span<Card const> hole, std::span<Card const> board, int opponents) const -> Equity;
+
+    auto options() const -> Options const& { return options_; }
+
+private:
+    Options options_;
+};
+
+} // namespace oraker
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <oraker/card.hpp>
+#include <oraker/equity.hpp>
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/lru_cache.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace oraker {
+
+// Hole cards, board and opponent count with suits renamed to a canonical order, so every situation that
+// only differs by a permutation of suits, and therefore has the same equity, maps to the same key.
+struct SituationKey {
+    CardMask hole = 0;
+    CardMask board = 0;
+    int opponents = 0;
+
+    auto operator<=>(SituationKey const&) const = default;
+};
+
+struct SituationKeyHash {
+    auto operator()(SituationKey const& key) const -> std::size_t;
+};
+
+// Suits are ordered by their board cards, then their hole cards; suits holding the same cards are
+// interchangeable, so the order is canonical.
+auto canonicalSituation(std::span<Card const> hole, std::span<Card const> board, int opponents) -> SituationKey;
+
+// Equity results shared across tables and hands, keyed by canonical situation. Keys are spread over
+// independently locked LruCache shards so concurrent tables rarely contend. A cached result is only
+// reused when its confidence interval is at least as narrow as the caller asks for; a less precise one
+// is recomputed and replaced.
+class EquityCache {
+public:
+    struct Options {
+        std::size_t capacity = 65'536;
+        int shards = 16;
+    };
+
+    struct Statistics {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        // Lookups that found the situation but with a wider interval than asked for.
+        std::size_t imprecise = 0;
+        std::size_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t memoryBytes = 0;
+
+        auto hitRate() const { return hits + misses + imprecise == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses + imprecise); }
+    };
+
+    explicit EquityCache(Options options);
+
+    // Cached equity with a half width of at most maxHalfWidth.
+    auto find(SituationKey const& key, double maxHalfWidth) -> std::optional<Equity>;
+    // Keeps an entry that is already at least as precise.
+    auto insert(SituationKey const& key, Equity const& equity) -> void;
+
+    // Computes outside the shard lock, so tables asking for the same new situation at once may both
+    // compute it.
+    template<typename Compute>
+    auto getOrCompute(SituationKey const& key, double maxHalfWidth, Compute&& compute) -> Equity {
+        if (auto const cached = find(key, maxHalfWidth)) {
+            return *cached;
+        }
+        auto const equity = compute();
+        insert(key, equity);
+        return equity;
+    }
+
+    // Summed over all shards, each locked in turn.
+    auto statistics() const -> Statistics;
+
+private:
+    struct Shard {
+        explicit Shard(std::size_t capacity)
+            : cache{capacity} {
+        }
+
+        mutable std::mutex mutex;
+        LruCache<SituationKey, Equity, SituationKeyHash> cache;
+        std::size_t imprecise = 0;
+    };
+
+    auto shardOf(SituationKey const& key) const -> Shard&;
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace oraker
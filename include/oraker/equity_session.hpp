@@ -0,0 +1,40 @@
+#pragma once
+
+#include <oraker/card.hpp>
+#include <oraker/range.hpp>
+#include <oraker/range_equity.hpp>
+
+#include <span>
+#include <vector>
+
+namespace oraker {
+
+// Range-vs-range equity of one hand followed street by street. Opening on the flop or turn evaluates every
+// runout once and keeps its matchups; each dealt card then only drops the runouts it rules out and sums
+// the rest, so turn and river updates never evaluate a hand. A known hero hand is a range of one combo.
+class EquitySession {
+public:
+    using Options = RangeEquity::Options;
+
+    // Takes a flop or turn. Throws like RangeEquity::evaluate() and on boards of other sizes.
+    EquitySession(Range const& hero, Range const& villain, std::span<Card const> board, Options options = {});
+
+    // Deals the next board card. Throws once the river is out or when the card is already on the board.
+    auto deal(Card card) -> void;
+
+    // Exact equity on the current board, from the runouts still possible.
+    auto equity() const -> RangeEquity::Result;
+    // Equity should the given card come next, without dealing it; 0 for cards already on the board.
+    auto equityAfter(Card card) const -> double;
+
+    auto board() const -> std::span<Card const> { return board_; }
+    // Runouts still possible on the current board.
+    auto runouts() const -> std::span<RangeEquity::Runout const> { return runouts_; }
+
+private:
+    std::vector<Card> board_;
+    std::vector<RangeEquity::Runout> runouts_;
+    int threads_ = 1;
+};
+
+} // namespace oraker
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <oraker/card.hpp>
+
+#include <cstdint>
+#include <span>
+
+namespace oraker {
+
+// Exact heads-up equity by enumerating every remaining board and, when the villain's hand is unknown,
+// every villain hand. Suit permutations that leave hero's hand, the board and a known villain hand
+// unchanged map deals onto equally valued deals, so only the smallest deal of each such class is
+// evaluated, weighted by the size of its class. Hero's hand is evaluated once per board. The remaining
+// boards are split across threads.
+class ExactEquity {
+public:
+    struct Options {
+        // 0 uses every hardware thread.
+        int threads = 0;
+        // Collapse deals that only differ by a permutation of suits.
+        bool isomorphism = true;
+    };
+
+    // Counts of deals hero wins, ties and loses; they sum to the number of possible deals.
+    struct Result {
+        std::uint64_t wins = 0;
+        std::uint64_t ties = 0;
+        std::uint64_t losses = 0;
+        // Deals actually evaluated after collapsing isomorphic ones.
+        std::uint64_t evaluated = 0;
+        double seconds = 0.0;
+        int threads = 1;
+
+        auto deals() const { return wins + ties + losses; }
+        auto equity() const { return deals() == 0 ? 0.0 : (wins + 0.5 * ties) / deals(); }
+    };
+
+    explicit ExactEquity(Options options);
+
+    // Takes hero's two hole cards, zero to five board cards and the villain's two hole cards or none for
+    // a random hand. Four or five hole cards on each side play Omaha. Throws on duplicate cards. Cost
+    // grows steeply with missing board cards: flop and later spots take milliseconds, preflop against a
+    // random hand is a large job, as is Omaha against a random hand before the river.
+    auto evaluate(std::span<Card const> hole, std::span<Card const> board, std::span<Card const> villain = {}) const -> Result;
+
+    auto options() const -> Options const& { return options_; }
+
+private:
+    Options options_;
+};
+
+} // namespace oraker
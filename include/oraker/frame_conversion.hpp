@@ -0,0 +1,86 @@
+#pragma once
+
+#include <oraker/luma.hpp>
+
+#include <opencv2/core.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace oraker {
+
+// Byte layout of one 8-bit-per-component source pixel: byte offsets of every channel, alpha at -1
+// when the source has none or its alpha byte is padding.
+struct PixelLayout {
+    int bytesPerPixel = 4;
+    int red = 0;
+    int green = 1;
+    int blue = 2;
+    int alpha = 3;
+    bool premultiplied = false;
+
+    constexpr auto operator==(PixelLayout const&) const -> bool = default;
+};
+
+constexpr auto BGR_LAYOUT = PixelLayout{3, 2, 1, 0, -1, false};
+constexpr auto RGB_LAYOUT = PixelLayout{3, 0, 1, 2, -1, false};
+constexpr auto RGBA_LAYOUT = PixelLayout{4, 0, 1, 2, 3, false};
+
+// Every layout a capture source can hand over: packed RGB/BGR plus each 32-bit order with alpha first
+// or last, straight, premultiplied or skipped. Each gets its own conversion kernels at compile time.
+constexpr auto SUPPORTED_PIXEL_LAYOUTS = std::array{
+    BGR_LAYOUT,
+    RGB_LAYOUT,
+    RGBA_LAYOUT,
+    PixelLayout{4, 0, 1, 2, 3, true},
+    PixelLayout{4, 0, 1, 2, -1, false},
+    PixelLayout{4, 1, 2, 3, 0, false},
+    PixelLayout{4, 1, 2, 3, 0, true},
+    PixelLayout{4, 1, 2, 3, -1, false},
+    PixelLayout{4, 2, 1, 0, 3, false},
+    PixelLayout{4, 2, 1, 0, 3, true},
+    PixelLayout{4, 2, 1, 0, -1, false},
+    PixelLayout{4, 3, 2, 1, 0, false},
+    PixelLayout{4, 3, 2, 1, 0, true},
+    PixelLayout{4, 3, 2, 1, -1, false},
+};
+
+// Planes to produce at native resolution and at 1/reducedScale (1, 2 or 4).
+struct ConversionRequest {
+    FrameFormats native;
+    FrameFormats reduced;
+    int reducedScale = 2;
+};
+
+// Planes that were not requested are left empty.
+struct ConvertedFrame {
+    cv::Size size;
+    cv::Mat bgr;
+    cv::Mat luma;
+    cv::Mat reducedBgr;
+    cv::Mat reducedLuma;
+};
+
+// Converts captures of one pixel layout into the requested planes in one pass over the source rows:
+// BGR and luma are written per pixel, and reduced planes are box-filtered from sums accumulated along
+// the way. Kernels are specialised on the layout and the requested planes and picked once per source.
+// Card and amount ROIs are cut from the native planes; change detection, deduplication and preview only
+// need the reduced ones. Output buffers are reused when they already have the right size.
+class CaptureConverter {
+public:
+    using RowKernel = void (*)(std::uint8_t const* source, int columns, std::uint8_t* bgr, std::uint8_t* gray, std::uint32_t* sums, int shift);
+
+    // Throws when the layout is not one of SUPPORTED_PIXEL_LAYOUTS.
+    explicit CaptureConverter(PixelLayout layout);
+
+    auto convert(cv::Mat const& capture, ConversionRequest const& request, ConvertedFrame& frame) const -> void;
+
+    auto layout() const -> PixelLayout const& { return layout_; }
+
+private:
+    PixelLayout layout_;
+    // Indexed by requested BGR, luma and reduction sums as bits 0, 1 and 2.
+    std::array<RowKernel, 8> kernels_;
+};
+
+} // namespace oraker
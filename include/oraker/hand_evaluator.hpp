@@ -0,0 +1,157 @@
+#pragma once
+
+#include <oraker/card.hpp>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace oraker {
+
+// Set of cards, bit Card::mask() per card: one 13-bit rank lane per suit at 16-bit spacing.
+using CardMask = std::uint64_t;
+
+// Strength of the best five-card hand: category in bits 24 and up, then up to five ranks as nibbles in
+// order of significance. Larger values win, equal values split.
+using HandValue = std::uint32_t;
+
+enum class HandCategory : std::uint8_t {
+    HIGH_CARD,
+    PAIR,
+    TWO_PAIR,
+    TRIPS,
+    STRAIGHT,
+    FLUSH,
+    FULL_HOUSE,
+    QUADS,
+    STRAIGHT_FLUSH,
+};
+
+constexpr auto handCategory(HandValue value) { return static_cast<HandCategory>(value >> 24); }
+auto categoryName(HandCategory category) -> std::string_view;
+
+auto handMask(std::span<Card const> cards) -> CardMask;
+// Parses concatenated two-character cards such as "AhKd" or "Qh7c2d"; nullopt on anything else.
+auto parseCards(std::string_view text) -> std::optional<std::vector<Card>>;
+
+// Per 13-bit rank set: top rank of the best straight plus one (0 without a straight), the top rank, and
+// the top five ranks packed as HandValue nibbles. Generated at compile time, 8192 entries each. SIMD
+// evaluation fetches everything with one gather from packed: top five in bits 0-19, top rank in 20-23,
+// straight in 24-27 and the number of ranks in 28-31.
+struct RankTables {
+    std::array<std::uint8_t, 8192> straight{};
+    std::array<std::uint8_t, 8192> top{};
+    std::array<std::uint32_t, 8192> topFive{};
+    std::array<std::uint32_t, 8192> packed{};
+};
+
+constexpr auto makeRankTables() {
+    auto tables = RankTables{};
+    for (auto ranks = 0u; ranks < 8192; ++ranks) {
+        for (auto top = 12; top >= 3; --top) {
+            // The wheel (A-2-3-4-5) is the lowest straight, its ace sits in bit 12.
+            auto const straight = top == 3 ? 0x100Fu : 0x1Fu << (top - 4);
+            if ((ranks & straight) == straight) {
+                tables.straight[ranks] = static_cast<std::uint8_t>(top + 1);
+                break;
+            }
+        }
+        auto taken = 0;
+        for (auto rank = 12; rank >= 0 && taken < 5; --rank) {
+            if ((ranks >> rank & 1) == 0) {
+                continue;
+            }
+            if (taken == 0) {
+                tables.top[ranks] = static_cast<std::uint8_t>(rank);
+            }
+            tables.topFive[ranks] |= static_cast<std::uint32_t>(rank) << (16 - 4 * taken++);
+        }
+        tables.packed[ranks] = tables.topFive[ranks] | std::uint32_t{tables.top[ranks]} << 20 | std::uint32_t{tables.straight[ranks]} << 24
+            | static_cast<std::uint32_t>(std::popcount(ranks)) << 28;
+    }
+    return tables;
+}
+
+inline constexpr auto RANK_TABLES = makeRankTables();
+
+// Evaluates five to seven cards with a handful of bit operations and table lookups, no branches on
+// individual cards. Follows the pokersource bitmask evaluator.
+constexpr auto evaluateHand(CardMask hand) -> HandValue {
+    constexpr auto LANE = 0x1FFFu;
+    auto const clubs = static_cast<std::uint32_t>(hand) & LANE;
+    auto const diamonds = static_cast<std::uint32_t>(hand >> 16) & LANE;
+    auto const hearts = static_cast<std::uint32_t>(hand >> 32) & LANE;
+    auto const spades = static_cast<std::uint32_t>(hand >> 48) & LANE;
+    auto const ranks = clubs | diamonds | hearts | spades;
+    // Counted through the table, which beats std::popcount on CPUs targeted without a popcount instruction.
+    auto const count = [](std::uint32_t ranks) { return static_cast<int>(RANK_TABLES.packed[ranks] >> 28); };
+    auto const rankCount = count(ranks);
+    auto const duplicates = count(clubs) + count(diamonds) + count(hearts) + count(spades) - rankCount;
+
+    auto const value = [](HandCategory category, std::uint32_t ranks) { return static_cast<HandValue>(category) << 24 | ranks; };
+    auto const top = [](std::uint32_t ranks) { return static_cast<std::uint32_t>(RANK_TABLES.top[ranks]); };
+
+    // With five distinct ranks a flush or straight beats anything the at most two duplicates can make.
+    if (rankCount >= 5) {
+        for (auto const suit : {clubs, diamonds, hearts, spades}) {
+            if (count(suit) >= 5) {
+                if (auto const straight = RANK_TABLES.straight[suit]; straight != 0) {
+                    return value(HandCategory::STRAIGHT_FLUSH, (straight - 1u) << 16);
+                }
+                return value(HandCategory::FLUSH, RANK_TABLES.topFive[suit]);
+            }
+        }
+        if (auto const straight = RANK_TABLES.straight[ranks]; straight != 0) {
+            return value(HandCategory::STRAIGHT, (straight - 1u) << 16);
+        }
+    }
+
+    // Ranks held an even number of times (pairs and quads), and ranks held at least three times.
+    auto const pairs = ranks ^ (clubs ^ diamonds ^ hearts ^ spades);
+    auto const trips = ((clubs & diamonds) | (hearts & spades)) & ((clubs & hearts) | (diamonds & spades));
+    switch (duplicates) {
+    case 0:
+        return value(HandCategory::HIGH_CARD, RANK_TABLES.topFive[ranks]);
+    case 1: {
+        auto const kickers = RANK_TABLES.topFive[ranks ^ pairs] >> 4 & 0xFFF0u;
+        return value(HandCategory::PAIR, top(pairs) << 16 | kickers);
+    }
+    case 2:
+        if (pairs != 0) {
+            auto const high = top(pairs);
+            return value(HandCategory::TWO_PAIR, high << 16 | top(pairs ^ 1u << high) << 12 | top(ranks ^ pairs) << 8);
+        } else {
+            auto const kickers = ranks ^ trips;
+            auto const first = top(kickers);
+            return value(HandCategory::TRIPS, top(trips) << 16 | first << 12 | top(kickers ^ 1u << first) << 8);
+        }
+    default:
+        if (auto const quads = clubs & diamonds & hearts & spades; quads != 0) {
+            auto const rank = top(quads);
+            return value(HandCategory::QUADS, rank << 16 | top(ranks ^ 1u << rank) << 12);
+        }
+        if (trips != 0) {
+            auto const rank = top(trips);
+            return value(HandCategory::FULL_HOUSE, rank << 16 | top((pairs | trips) ^ 1u << rank) << 12);
+        }
+        // Three pairs: the best two play with the best remaining card as kicker.
+        auto const high = top(pairs);
+        auto const second = top(pairs ^ 1u << high);
+        return value(HandCategory::TWO_PAIR, high << 16 | second << 12 | top(ranks ^ (1u << high) ^ (1u << second)) << 8);
+    }
+}
+
+// Widest batch evaluation the CPU supports, detected once. Only x86-64 has SIMD kernels.
+enum class SimdLevel : std::uint8_t { SCALAR, AVX2, AVX512 };
+auto simdLevel() -> SimdLevel;
+
+// Evaluates every hand together with the shared board cards, e.g. all combos of a range on one runout:
+// 16 hands per step with AVX-512, 8 with AVX2, the rest one at a time. Levels above simdLevel() fall
+// back to it.
+auto evaluateHands(std::span<CardMask const> hands, CardMask board, std::span<HandValue> values, SimdLevel level = simdLevel()) -> void;
+
+} // namespace oraker
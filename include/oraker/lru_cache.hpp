@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace oraker {
+
+// Bounded segmented LRU cache. New keys enter a probationary segment and are promoted to the protected
+// segment on their second hit, so bursts of one-off keys (animations, a table opening or closing) only
+// churn probation and never flush the entries every table keeps hitting. Not thread-safe.
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+    struct Statistics {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t evictions = 0;
+
+        auto hitRate() const { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses); }
+    };
+
+    explicit LruCache(std::size_t capacity, double protectedFraction = 0.8)
+        : capacity_{std::max<std::size_t>(capacity, 1)}
+        , protectedCapacity_{std::min(static_cast<std::size_t>(capacity_ * protectedFraction), capacity_ - 1)} {
+        index_.reserve(capacity_);
+    }
+
+    // Returns the cached value and refreshes its recency, or nullptr on a miss.
+    auto find(Key const& key) -> Value const* {
+        auto const it = index_.find(key);
+        if (it == index_.end()) {
+            ++statistics_.misses;
+            return nullptr;
+        }
+        ++statistics_.hits;
+        auto& [node, isProtected] = it->second;
+        protected_.splice(protected_.begin(), isProtected ? protected_ : probation_, node);
+        if (!isProtected) {
+            isProtected = true;
+            demoteOverflow();
+        }
+        return &node->second;
+    }
+
+    // Returns the cached value without counting a hit or refreshing its recency, or nullptr.
+    auto peek(Key const& key) const -> Value const* {
+        auto const it = index_.find(key);
+        return it == index_.end() ? nullptr : &it->second.first->second;
+    }
+
+    auto insert(Key const& key, Value value) -> void {
+        if (auto const it = index_.find(key); it != index_.end()) {
+            it->second.first->second = std::move(value);
+            return;
+        }
+        if (index_.size() >= capacity_) {
+            evict();
+        }
+        probation_.emplace_front(key, std::move(value));
+        index_.emplace(key, std::pair{probation_.begin(), false});
+    }
+
+    template<typename Compute>
+    auto getOrCompute(Key const& key, Compute&& compute) -> Value {
+        if (auto const cached = find(key)) {
+            return *cached;
+        }
+        auto value = compute();
+        insert(key, value);
+        return value;
+    }
+
+    auto size() const { return index_.size(); }
+    auto capacity() const { return capacity_; }
+    auto statistics() const -> Statistics const& { return statistics_; }
+
+    // Estimated heap bytes: list and index nodes plus index buckets, excluding memory owned by the values.
+    auto memoryFootprint() const {
+        constexpr auto LIST_NODE = sizeof(Entry) + 2 * sizeof(void*);
+        constexpr auto INDEX_NODE = sizeof(Key) + sizeof(Slot) + 2 * sizeof(void*);
+        return index_.size() * (LIST_NODE + INDEX_NODE) + index_.bucket_count() * sizeof(void*);
+    }
+
+private:
+    using Entry = std::pair<Key, Value>;
+    using List = std::list<Entry>;
+    // Node in one of the segment lists and whether that list is the protected one.
+    using Slot = std::pair<typename List::iterator, bool>;
+
+    auto demoteOverflow() -> void {
+        while (protected_.size() > protectedCapacity_) {
+            auto const last = std::prev(protected_.end());
+            index_.find(last->first)->second.second = false;
+            probation_.splice(probation_.begin(), protected_, last);
+        }
+    }
+
+    auto evict() -> void {
+        auto& victims = probation_.empty() ? protected_ : probation_;
+        index_.erase(victims.back().first);
+        victims.pop_back();
+        ++statistics_.evictions;
+    }
+
+    std::size_t capacity_;
+    std::size_t protectedCapacity_;
+    List probation_;
+    List protected_;
+    std::unordered_map<Key, Slot, Hash> index_;
+    Statistics statistics_;
+};
+
+} // namespace oraker
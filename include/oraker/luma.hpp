@@ -0,0 +1,25 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <cstdint>
+
+namespace oraker {
+
+// Planes a frame consumer reads. Consumers declare theirs so conversion only produces 3-channel
+// colour when a colour-sensitive stage asks for it.
+struct FrameFormats {
+    bool bgr = false;
+    bool luma = false;
+
+    constexpr auto operator|(FrameFormats other) const { return FrameFormats{bgr || other.bgr, luma || other.luma}; }
+};
+
+// BT.601 luminance in 14-bit fixed point, the weights cv::cvtColor uses for BGR to grey.
+constexpr auto luma(std::uint32_t blue, std::uint32_t green, std::uint32_t red) {
+    return static_cast<std::uint8_t>((blue * 1868 + green * 9617 + red * 4899 + (1u << 13)) >> 14);
+}
+
+// Single-channel luminance of a BGR, BGRA or already grey image; grey input is returned without a copy.
+auto toLuma(cv::Mat const& image) -> cv::Mat;
+
+} // namespace oraker
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace oraker {
+
+// Read-only memory mapping of a whole file; pages are faulted in lazily by the kernel
+// instead of being copied up front into a heap buffer.
+class MappedFile {
+public:
+    explicit MappedFile(std::filesystem::path const& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    auto bytes() const { return std::span<std::byte const>{data_, size_}; }
+    auto data() const { return data_; }
+    auto size() const { return size_; }
+
+private:
+    std::byte const* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace oraker
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <oraker/hand_evaluator.hpp>
+
+namespace oraker {
+
+// Best Omaha hand of four or five hole cards on a five-card board, which must use exactly two hole and
+// three board cards; valued like evaluateHand() so the two compare directly.
+//
+// Rather than evaluating all 60 (or 100) combinations, each hole pair is first bounded by the best hand
+// of the pair and the whole board: that hand may use fewer than three board cards, so no triple can beat
+// it. Pairs are tried from the highest bound down, a pair's triples stop once one reaches its bound, and
+// pairs stop once no bound beats the best hand found.
+auto evaluateOmaha(CardMask hole, CardMask board) -> HandValue;
+
+// The same hand from all 60 or 100 combinations, for checking evaluateOmaha().
+auto evaluateOmahaExhaustive(CardMask hole, CardMask board) -> HandValue;
+
+} // namespace oraker
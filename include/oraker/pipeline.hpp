@@ -0,0 +1,142 @@
+#pragma once
+
+#include <oraker/spsc_queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace oraker {
+
+// Runs stages on their own threads, connected by SPSC queues of frame handles. Frames come from a
+// fixed pool that circulates from the last stage back to the first, so the source never allocates
+// and can work on frame N + 1 while later stages still process frame N. The last stage runs on
+// the calling thread, which keeps UI work (cv::imshow) on the main thread.
+template<typename Frame>
+class Pipeline {
+public:
+    // Returning false from a stage stops the source; frames already in flight drain through the rest.
+    // The frame a non-source stage rejects still passes to the later stages, so it must carry enough
+    // state for them to skip it and release what it holds.
+    using Stage = std::function<bool(Frame&)>;
+
+    struct StageStatistics {
+        std::string name;
+        std::size_t frames = 0;
+        double busySeconds = 0.0;
+        double utilisation = 0.0;
+    };
+
+    explicit Pipeline(std::size_t queueDepth = 4)
+        : queueDepth_{queueDepth} {
+    }
+
+    auto addStage(std::string name, Stage process, std::size_t queueDepth = 0) -> Pipeline& {
+        stages_.push_back({std::move(name), std::move(process), queueDepth == 0 ? queueDepth_ : queueDepth});
+        return *this;
+    }
+
+    auto run() -> void {
+        if (stages_.empty()) {
+            throw std::logic_error("Pipeline has no stages");
+        }
+
+        // Stage i reads from queues[i] and writes to queues[i + 1]; queues[0] recycles frames from the last stage.
+        auto poolSize = stages_.size();
+        for (auto const& stage : stages_) {
+            poolSize += stage.queueDepth;
+        }
+        auto pool = std::vector<Frame>(poolSize);
+        auto queues = std::vector<std::unique_ptr<SpscQueue<Frame*>>>{};
+        queues.push_back(std::make_unique<SpscQueue<Frame*>>(poolSize));
+        for (auto index = std::size_t{1}; index < stages_.size(); ++index) {
+            queues.push_back(std::make_unique<SpscQueue<Frame*>>(stages_[index].queueDepth));
+        }
+        for (auto& frame : pool) {
+            queues.front()->push(&frame);
+        }
+
+        stopped_ = false;
+        auto const started = Clock::now();
+        auto threads = std::vector<std::thread>{};
+        for (auto index = std::size_t{0}; index + 1 < stages_.size(); ++index) {
+            threads.emplace_back([this, &queues, index] { runStage(index, queues); });
+        }
+        runStage(stages_.size() - 1, queues);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        elapsed_ = Clock::now() - started;
+    }
+
+    auto stop() -> void { stopped_ = true; }
+    auto stopRequested() const -> bool { return stopped_; }
+
+    // Valid once run() has returned.
+    auto statistics() const -> std::vector<StageStatistics> {
+        auto result = std::vector<StageStatistics>{};
+        for (auto const& stage : stages_) {
+            auto const busy = std::chrono::duration<double>(stage.busy).count();
+            auto const wall = std::chrono::duration<double>(elapsed_).count();
+            result.push_back({stage.name, stage.frames, busy, wall > 0.0 ? busy / wall : 0.0});
+        }
+        return result;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct StageState {
+        std::string name;
+        Stage process;
+        std::size_t queueDepth = 0;
+        std::size_t frames = 0;
+        Clock::duration busy{};
+    };
+
+    auto runStage(std::size_t index, std::vector<std::unique_ptr<SpscQueue<Frame*>>>& queues) -> void {
+        auto& stage = stages_[index];
+        auto const isSource = index == 0;
+        auto const isSink = index + 1 == stages_.size();
+        auto& input = *queues[index];
+        auto& output = *queues[isSink ? 0 : index + 1];
+
+        while (!(isSource && stopped_)) {
+            auto* const frame = input.pop();
+            if (frame == nullptr) {
+                break;
+            }
+
+            auto const started = Clock::now();
+            auto const keep = stage.process(*frame);
+            stage.busy += Clock::now() - started;
+            ++stage.frames;
+
+            if (!keep) {
+                stopped_ = true;
+                if (isSource) {
+                    break;
+                }
+            }
+            output.push(frame);
+        }
+
+        // A null handle marks the end of the stream for the next stage.
+        if (!isSink) {
+            output.push(nullptr);
+        }
+    }
+
+    std::size_t queueDepth_;
+    std::vector<StageState> stages_;
+    std::atomic<bool> stopped_{false};
+    Clock::duration elapsed_{};
+};
+
+} // namespace oraker
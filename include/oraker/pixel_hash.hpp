@@ -0,0 +1,18 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace oraker {
+
+// 64-bit hash of an image's pixels, its size and type, reading eight bytes per step. Works on ROIs
+// without copying them; identical crops from any frame or table hash equally.
+auto hashPixels(cv::Mat const& image) -> std::uint64_t;
+
+// Hasher for containers keyed by hashPixels values, which need no further mixing.
+struct PixelHashKey {
+    auto operator()(std::uint64_t hash) const { return static_cast<std::size_t>(hash); }
+};
+
+} // namespace oraker
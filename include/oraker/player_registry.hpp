@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace oraker {
+
+// Stable integer IDs for player names, so downstream analytics key by int instead of strings.
+// IDs are dense and assigned in order of first appearance; they are valid for the process lifetime.
+class PlayerRegistry {
+public:
+    // Registers unseen names.
+    auto idOf(std::string_view name) -> int;
+    auto find(std::string_view name) const -> std::optional<int>;
+    auto name(int id) const -> std::string const& { return names_[static_cast<std::size_t>(id)]; }
+    auto size() const { return names_.size(); }
+
+private:
+    struct NameHash {
+        using is_transparent = void;
+        auto operator()(std::string_view name) const -> std::size_t { return std::hash<std::string_view>{}(name); }
+    };
+
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, int, NameHash, std::equal_to<>> ids_;
+};
+
+} // namespace oraker
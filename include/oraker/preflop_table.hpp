@@ -0,0 +1,86 @@
+#pragma once
+
+#include <oraker/card.hpp>
+#include <oraker/mapped_file.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace oraker {
+
+// Precomputed preflop equity of the 169 starting-hand classes against one to nine random hands,
+// heads-up against named ranges and optionally heads-up against every other class, generated offline
+// by oraker-generate-preflop. The file is mapped, not read, so opening costs a header check and every
+// lookup is one load from the mapping.
+//
+// Classes index a 13 x 13 grid: pairs on the diagonal at rank * 13 + rank, suited hands at
+// high * 13 + low and offsuit hands at low * 13 + high.
+class PreflopTable {
+public:
+    static constexpr auto CLASSES = 169;
+    static constexpr auto MAX_OPPONENTS = 9;
+    static constexpr auto MAX_RANGE_NAME = std::size_t{31};
+    // Bumped whenever the file layout or the meaning of its entries changes.
+    static constexpr auto VERSION = std::uint32_t{2};
+
+    struct Contents {
+        // Hands simulated per random-opponent entry and boards per range entry.
+        std::uint64_t hands = 0;
+        std::uint64_t boards = 0;
+        // CLASSES entries per opponent count, starting with one opponent.
+        std::vector<float> random;
+        std::vector<std::pair<std::string, std::vector<float>>> ranges;
+        // Empty, or CLASSES x CLASSES entries: row hero's class, column villain's, averaged over every
+        // pair of combos that do not share a card.
+        std::vector<float> matchups;
+    };
+
+    // Throws when the file is missing, truncated, from another version or written on a host with a
+    // different byte order.
+    explicit PreflopTable(std::filesystem::path const& path);
+    static auto write(std::filesystem::path const& path, Contents const& contents) -> void;
+
+    static constexpr auto classIndex(Card first, Card second) {
+        auto const high = std::max(first.rank(), second.rank());
+        auto const low = std::min(first.rank(), second.rank());
+        return first.suit() == second.suit() || high == low ? high * 13 + low : low * 13 + high;
+    }
+    // "AA", "AKs" or "AKo".
+    static auto className(int handClass) -> std::string;
+    // One combo of the class; every combo of a class has the same equity against random hands.
+    static auto representative(int handClass) -> std::pair<Card, Card>;
+
+    auto maxOpponents() const { return opponents_; }
+    auto equity(int handClass, int opponents) const -> float;
+    auto equity(Card first, Card second, int opponents) const { return equity(classIndex(first, second), opponents); }
+
+    auto rangeNames() const -> std::vector<std::string_view>;
+    auto findRange(std::string_view name) const -> std::optional<int>;
+    auto rangeEquity(int handClass, int range) const -> float;
+
+    auto hasMatchups() const { return matchups_; }
+    // Throws when the table was generated without matchups.
+    auto matchupEquity(int handClass, int villainClass) const -> float;
+
+    auto hands() const { return hands_; }
+    auto boards() const { return boards_; }
+
+private:
+    auto load(std::size_t offset) const -> float;
+
+    MappedFile file_;
+    int opponents_ = 0;
+    int ranges_ = 0;
+    bool matchups_ = false;
+    std::uint64_t hands_ = 0;
+    std::uint64_t boards_ = 0;
+};
+
+} // namespace oraker
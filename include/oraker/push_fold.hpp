@@ -0,0 +1,77 @@
+#pragma once
+
+#include <oraker/preflop_table.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace oraker {
+
+// Push/fold equilibrium of a short-stacked preflop spot: the first player to enter the pot moves all-in,
+// later players call or fold, and everyone else folds once a player has called, so every all-in is heads
+// up. Strategies over the 169 hand classes are found by iterated best response with averaging, taking
+// class-vs-class equity from a PreflopTable generated with matchups. Payoffs are chips or, with payouts
+// given, ICM prize equity in the Malmuth-Harville model expressed in big blinds of the total chips so
+// both share one scale.
+class PushFoldSolver {
+public:
+    static constexpr auto MAX_PLAYERS = 10;
+
+    struct Options {
+        // Threads solving spots in parallel, 0 uses every hardware thread.
+        int threads = 0;
+        int maxIterations = 2'000;
+        // Stops once no player gains more than this many big blinds per hand by deviating.
+        double tolerance = 1e-3;
+    };
+
+    struct Spot {
+        // Stacks in big blinds in order of action: the first player to act first, then around to the
+        // small blind and the big blind last. Heads-up the small blind acts first.
+        std::vector<double> stacks;
+        double smallBlind = 0.5;
+        double ante = 0.0;
+        // Prize fractions from first place down; empty plays for chips.
+        std::vector<double> payouts;
+    };
+
+    struct Solution {
+        int players = 0;
+        // push[p][class]: chance player p moves all-in when folded to; all zero for the big blind.
+        std::vector<std::array<float, PreflopTable::CLASSES>> push;
+        // call[c * players + p][class]: chance player c calls an all-in from p, players between folded.
+        std::vector<std::array<float, PreflopTable::CLASSES>> call;
+        int iterations = 0;
+        // Most any single player gains in big blinds per hand by switching to a best response.
+        double exploitability = 0.0;
+        bool converged = false;
+        double seconds = 0.0;
+
+        auto callRange(int caller, int pusher) const -> std::array<float, PreflopTable::CLASSES> const& {
+            return call[static_cast<std::size_t>(caller * players + pusher)];
+        }
+        // Share of all dealt hands the player pushes, or calls with against the pusher.
+        auto pushFrequency(int player) const -> double;
+        auto callFrequency(int caller, int pusher) const -> double;
+    };
+
+    // Throws when the table has no class matchups.
+    PushFoldSolver(PreflopTable const& table, Options options);
+
+    // Throws on fewer than two or more than ten players or stacks that cannot cover blinds and ante.
+    auto solve(Spot const& spot) const -> Solution;
+    // Solves every spot, spots split across threads.
+    auto solve(std::span<Spot const> spots) const -> std::vector<Solution>;
+
+    auto options() const -> Options const& { return options_; }
+
+private:
+    Options options_;
+    // Row hero's class, column villain's.
+    std::vector<float> equity_;
+    // Combo pairs of two classes that share no card.
+    std::vector<float> pairs_;
+};
+
+} // namespace oraker
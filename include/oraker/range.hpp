@@ -0,0 +1,69 @@
+#pragma once
+
+#include <oraker/card.hpp>
+#include <oraker/hand_evaluator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+namespace oraker {
+
+constexpr auto COMBO_COUNT = 1326;
+
+// Cards and masks of every combo in Range order, built at compile time.
+constexpr auto makeComboCards() {
+    auto cards = std::array<std::pair<Card, Card>, COMBO_COUNT>{};
+    for (auto high = 1; high < Card::COUNT; ++high) {
+        for (auto low = 0; low < high; ++low) {
+            cards[static_cast<std::size_t>(high * (high - 1) / 2 + low)] = {Card::fromIndex(low), Card::fromIndex(high)};
+        }
+    }
+    return cards;
+}
+
+inline constexpr auto COMBO_CARDS = makeComboCards();
+
+constexpr auto makeComboMasks() {
+    auto masks = std::array<CardMask, COMBO_COUNT>{};
+    for (auto combo = std::size_t{0}; combo < masks.size(); ++combo) {
+        masks[combo] = COMBO_CARDS[combo].first.mask() | COMBO_CARDS[combo].second.mask();
+    }
+    return masks;
+}
+
+inline constexpr auto COMBO_MASKS = makeComboMasks();
+
+// Weight of every two-card combo a player may hold, 0 for combos outside the range. Combo c of cards
+// i < j has index j * (j - 1) / 2 + i over card indices.
+class Range {
+public:
+    static constexpr auto COMBOS = COMBO_COUNT;
+
+    static constexpr auto comboIndex(Card first, Card second) -> int {
+        auto const low = std::min(first.index(), second.index());
+        auto const high = std::max(first.index(), second.index());
+        return high * (high - 1) / 2 + low;
+    }
+    static constexpr auto comboCards(int combo) -> std::pair<Card, Card> const& { return COMBO_CARDS[static_cast<std::size_t>(combo)]; }
+    static constexpr auto comboMask(int combo) { return COMBO_MASKS[static_cast<std::size_t>(combo)]; }
+
+    // Comma-separated hands with optional ":weight": pairs "TT", suited or offsuit classes "AKs", "AKo",
+    // both "AK", ladders "TT+", "ATs+", spans "A5s-A2s", "99-66" and exact combos "AhKh". Later
+    // entries override earlier ones. Throws on anything else.
+    static auto parse(std::string_view text) -> Range;
+    static auto full() -> Range;
+
+    auto weight(int combo) const { return weights_[static_cast<std::size_t>(combo)]; }
+    auto setWeight(int combo, float weight) -> void { weights_[static_cast<std::size_t>(combo)] = weight; }
+    auto weights() const -> std::array<float, COMBOS> const& { return weights_; }
+    // Combos with non-zero weight.
+    auto size() const -> int;
+
+private:
+    std::array<float, COMBOS> weights_{};
+};
+
+} // namespace oraker
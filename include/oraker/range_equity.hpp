@@ -0,0 +1,74 @@
+#pragma once
+
+#include <oraker/card.hpp>
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/range.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace oraker {
+
+// Equity of one weighted range against another, every compatible pair of combos weighted by the product
+// of their weights. On each board all live combos of both ranges are evaluated in one batch and sorted by
+// value; a single merged sweep then gives every hero combo the villain weight it beats and ties, with
+// card removal applied by subtracting per-card weight sums. Boards are enumerated when at most two cards
+// are missing and sampled otherwise. Batches of boards are split across threads and summed in batch
+// order, so a seed gives the same result on any thread count.
+class RangeEquity {
+public:
+    struct Options {
+        // 0 uses every hardware thread.
+        int threads = 0;
+        std::uint64_t seed = 1;
+        // Sampled boards when more than two board cards are missing, rounded up to whole batches.
+        int boards = 2'048;
+        int boardsPerBatch = 64;
+    };
+
+    struct Result {
+        double equity = 0.0;
+        double win = 0.0;
+        double tie = 0.0;
+        // Half width of the 95% confidence interval around equity, 0 when boards were enumerated.
+        double halfWidth = 0.0;
+        std::uint64_t boards = 0;
+        bool exact = false;
+        double seconds = 0.0;
+        int threads = 1;
+    };
+
+    // Weighted combo pairs on one board or summed over several: hero wins, ties and all compatible pairs.
+    struct Matchups {
+        double win = 0.0;
+        double tie = 0.0;
+        double all = 0.0;
+
+        auto operator+=(Matchups const& other) -> Matchups&;
+        auto equity() const { return all > 0.0 ? (win + 0.5 * tie) / all : 0.0; }
+    };
+
+    // Matchups on one completion of the board, cards holding the dealt turn and river bits.
+    struct Runout {
+        CardMask cards = 0;
+        Matchups matchups;
+    };
+
+    explicit RangeEquity(Options options);
+
+    // Throws when the board holds duplicate or more than five cards, or when either range has no combo
+    // left beside the board.
+    auto evaluate(Range const& hero, Range const& villain, std::span<Card const> board) const -> Result;
+
+    // Matchups on every completion of a flop, turn or river board, the per-runout breakdown that evaluate()
+    // sums up. Throws like evaluate() and on boards with fewer than three cards.
+    auto runouts(Range const& hero, Range const& villain, std::span<Card const> board) const -> std::vector<Runout>;
+
+    auto options() const -> Options const& { return options_; }
+
+private:
+    Options options_;
+};
+
+} // namespace oraker
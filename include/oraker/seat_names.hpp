@@ -0,0 +1,48 @@
+#pragma once
+
+#include <oraker/luma.hpp>
+#include <oraker/lru_cache.hpp>
+#include <oraker/pixel_hash.hpp>
+#include <oraker/player_registry.hpp>
+#include <oraker/table_layout.hpp>
+#include <oraker/text_reader.hpp>
+
+#include <opencv2/core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oraker {
+
+// Player IDs per seat. Names change only when someone sits down or leaves, so a seat's name region is
+// hashed every frame and read only when the hash changes; name images seen before, e.g. after a player
+// moves seats, resolve through a cache without reading.
+class SeatNameReader {
+public:
+    static constexpr auto ALPHABET = std::string_view{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789_-."};
+    static constexpr auto FRAME_FORMATS = FrameFormats{.luma = true};
+    static constexpr auto NO_PLAYER = -1;
+
+    struct Statistics {
+        std::size_t checks = 0;
+        std::size_t reads = 0;
+    };
+
+    SeatNameReader(TextReader reader, PlayerRegistry& registry, std::size_t cacheEntries = 1024);
+
+    // Returns the player ID of every layout seat, NO_PLAYER for empty seats and unreadable names.
+    auto update(cv::Mat const& luma, TableLayout const& layout) -> std::vector<int> const&;
+
+    auto players() const -> std::vector<int> const& { return players_; }
+    auto statistics() const -> Statistics const& { return statistics_; }
+
+private:
+    TextReader reader_;
+    PlayerRegistry& registry_;
+    LruCache<std::uint64_t, int, PixelHashKey> cache_;
+    std::vector<std::uint64_t> hashes_;
+    std::vector<int> players_;
+    Statistics statistics_;
+};
+
+} // namespace oraker
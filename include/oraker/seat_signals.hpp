@@ -0,0 +1,50 @@
+#pragma once
+
+#include <oraker/luma.hpp>
+#include <oraker/table_layout.hpp>
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace oraker {
+
+// Inclusive HSV range (OpenCV hue runs 0-180).
+struct ColourRange {
+    cv::Scalar lower;
+    cv::Scalar upper;
+};
+
+// Reads per-seat state that Poker Now renders as coloured highlights by counting pixels inside colour
+// ranges, only within the calibrated seat ROIs. Costs a few microseconds per seat.
+class SeatSignalReader {
+public:
+    static constexpr auto FRAME_FORMATS = FrameFormats{.bgr = true};
+
+    // Defaults match Poker Now's default theme.
+    struct Options {
+        // White dealer button disc.
+        ColourRange dealerButton{{0, 0, 200}, {180, 50, 255}};
+        // Green turn timer bar drawn over the acting player's seat plate.
+        ColourRange timer{{35, 110, 110}, {85, 255, 255}};
+        double dealerCoverage = 0.3;
+        double timerCoverage = 0.04;
+        // Folded players' plates are greyed out, leaving almost no saturated pixels.
+        double foldedSaturation = 20.0;
+    };
+
+    struct Signals {
+        bool dealer = false;
+        bool acting = false;
+        bool folded = false;
+    };
+
+    explicit SeatSignalReader(Options options);
+
+    auto read(cv::Mat const& frame, SeatLayout const& seat) const -> Signals;
+    auto read(cv::Mat const& frame, TableLayout const& layout) const -> std::vector<Signals>;
+
+private:
+    Options options_;
+};
+
+} // namespace oraker
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+
+namespace oraker {
+
+// Bounded lock-free single-producer single-consumer ring buffer. Capacity is rounded up to a power
+// of two; head and tail live on separate cache lines so producer and consumer never share one.
+// Blocking helpers park the caller on the opposite index with atomic wait instead of spinning.
+template<typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(std::size_t capacity)
+        : mask_{std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1}
+        , slots_{std::make_unique<T[]>(mask_ + 1)} {
+    }
+
+    SpscQueue(SpscQueue const&) = delete;
+    SpscQueue& operator=(SpscQueue const&) = delete;
+
+    auto capacity() const { return mask_ + 1; }
+
+    auto tryPush(T value) -> bool {
+        auto const tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) > mask_) {
+            return false;
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        tail_.notify_one();
+        return true;
+    }
+
+    auto tryPop() -> std::optional<T> {
+        auto const head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+        auto value = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        head_.notify_one();
+        return value;
+    }
+
+    auto push(T value) -> void {
+        for (auto tail = tail_.load(std::memory_order_relaxed); tail - head_.load(std::memory_order_acquire) > mask_;) {
+            head_.wait(tail - mask_ - 1, std::memory_order_acquire);
+        }
+        tryPush(std::move(value));
+    }
+
+    auto pop() -> T {
+        for (auto head = head_.load(std::memory_order_relaxed); head == tail_.load(std::memory_order_acquire);) {
+            tail_.wait(head, std::memory_order_acquire);
+        }
+        return *tryPop();
+    }
+
+    auto size() const -> std::size_t {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr auto CACHE_LINE = std::size_t{64};
+
+    std::size_t const mask_;
+    std::unique_ptr<T[]> slots_;
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0};
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};
+};
+
+} // namespace oraker
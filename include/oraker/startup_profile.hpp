@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace oraker {
+
+// Records when startup phases begin and how long they take, relative to construction.
+// Phases may be recorded from several threads, e.g. the background model load and capture.
+class StartupProfile {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase {
+        std::string name;
+        Clock::duration begin{};
+        Clock::duration duration{};
+    };
+
+    StartupProfile()
+        : started_{Clock::now()} {
+    }
+
+    template<typename Function>
+    auto measure(std::string name, Function&& function) -> decltype(function()) {
+        auto const begin = Clock::now();
+        struct Recorder {
+            StartupProfile& profile;
+            std::string& name;
+            Clock::time_point begin;
+            ~Recorder() { profile.record(std::move(name), begin, Clock::now()); }
+        } const recorder{*this, name, begin};
+        return function();
+    }
+
+    // Records an instantaneous milestone such as the first captured frame.
+    auto mark(std::string name) -> void {
+        auto const now = Clock::now();
+        record(std::move(name), now, now);
+    }
+
+    auto phases() const -> std::vector<Phase> {
+        auto const lock = std::scoped_lock{mutex_};
+        return phases_;
+    }
+
+    auto report(std::ostream& stream) const -> void {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        for (auto const& phase : phases()) {
+            stream << "startup: " << phase.name << " at " << Milliseconds{phase.begin}.count() << " ms";
+            if (phase.duration != Clock::duration::zero()) {
+                stream << ", took " << Milliseconds{phase.duration}.count() << " ms";
+            }
+            stream << '\n';
+        }
+    }
+
+private:
+    auto record(std::string name, Clock::time_point begin, Clock::time_point end) -> void {
+        auto const lock = std::scoped_lock{mutex_};
+        phases_.push_back({std::move(name), begin - started_, end - begin});
+    }
+
+    Clock::time_point const started_;
+    mutable std::mutex mutex_;
+    std::vector<Phase> phases_;
+};
+
+} // namespace oraker
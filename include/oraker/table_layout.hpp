@@ -0,0 +1,83 @@
+#pragma once
+
+#include <oraker/detector.hpp>
+#include <oraker/table_regions.hpp>
+
+#include <opencv2/core.hpp>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace oraker {
+
+// Seat geometry in native frame pixels; cards and dealerButton stay empty until they were observed.
+struct SeatLayout {
+    cv::Rect anchor;
+    cv::Rect name;
+    cv::Rect stack;
+    cv::Rect cards;
+    cv::Rect dealerButton;
+};
+
+// Table geometry for one window size, so reading a frame is a handful of fixed crops.
+struct TableLayout {
+    cv::Size windowSize;
+    std::vector<SeatLayout> seats;
+    // Community card slots from left to right.
+    std::vector<cv::Rect> board;
+    cv::Rect pot;
+
+    // Areas worth running the detector on, for tiled inference.
+    auto regions() const -> std::vector<TableRegion>;
+};
+
+// Layout files hold one entry per calibrated window size.
+auto loadLayouts(std::filesystem::path const& path) -> std::vector<TableLayout>;
+auto saveLayouts(std::filesystem::path const& path, std::span<TableLayout const> layouts) -> void;
+auto findLayout(std::span<TableLayout const> layouts, cv::Size windowSize) -> std::optional<TableLayout>;
+
+// Derives a layout from full-frame detections collected over a few frames. Detections are sorted into
+// table elements by class name: card classes, and classes containing "seat", "pot" or "dealer".
+class LayoutCalibrator {
+public:
+    static constexpr auto BOARD_SLOTS = 5;
+
+    struct Options {
+        int frames = 10;
+        float mergeIou = 0.3f;
+    };
+
+    LayoutCalibrator(std::vector<std::string> classNames, Options options);
+
+    // Restarts calibration whenever the frame size differs from the one observed so far.
+    auto observe(std::span<Detection const> detections, cv::Size frameSize) -> void;
+    auto ready() const { return frames_ >= options_.frames; }
+    // Empty when neither seats nor board cards were seen.
+    auto layout() const -> std::optional<TableLayout>;
+
+private:
+    struct Cluster {
+        cv::Rect2f sum;
+        int count = 0;
+
+        auto box() const { return cv::Rect{cv::Rect2f{sum.x / count, sum.y / count, sum.width / count, sum.height / count}}; }
+    };
+
+    enum class Element { NONE, CARD, SEAT, POT, DEALER };
+
+    auto elementOf(int classId) const -> Element;
+    auto accumulate(std::vector<Cluster>& clusters, cv::Rect2f const& box) const -> void;
+
+    std::vector<std::string> classNames_;
+    Options options_;
+    cv::Size frameSize_;
+    int frames_ = 0;
+    std::vector<Cluster> cards_;
+    std::vector<Cluster> seats_;
+    std::vector<Cluster> pots_;
+    std::vector<Cluster> dealers_;
+};
+
+} // namespace oraker
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <oraker/detector.hpp>
+
+#include <opencv2/core.hpp>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace oraker {
+
+// Named part of the table (hole cards, board, pot, seat) in native frame pixels.
+struct TableRegion {
+    std::string name;
+    cv::Rect rect;
+};
+
+auto loadRegions(std::filesystem::path const& path) -> std::vector<TableRegion>;
+auto saveRegions(std::filesystem::path const& path, std::span<TableRegion const> regions) -> void;
+
+// Grows regions around full-frame detections until they cover everything the detector ever reported,
+// so tiled inference can bootstrap itself when no region file is configured.
+class RegionLearner {
+public:
+    explicit RegionLearner(int padding = 24);
+
+    auto observe(std::span<Detection const> detections, cv::Size frameSize) -> void;
+    auto regions() const -> std::vector<TableRegion> const& { return regions_; }
+
+private:
+    int padding_;
+    std::vector<TableRegion> regions_;
+};
+
+} // namespace oraker
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <oraker/card_recognizer.hpp>
+
+#include <opencv2/core.hpp>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace oraker {
+
+// Reads single-line text rendered in one fixed font, restricted to an alphabet. The field is binarised
+// with one vectorised threshold, glyphs are split on empty columns of the ink projection and every glyph
+// is classified against a cached glyph set, so a field costs microseconds. Touching glyphs cannot be
+// split and spaces are dropped; learning rejects fields where segmentation disagrees with the label.
+class TextReader {
+public:
+    struct Options {
+        cv::Size glyphSize{12, 18};
+        double minScore = 0.7;
+        // Fixed binarisation level, Otsu's method picks one per field when negative.
+        int threshold = -1;
+    };
+
+    struct Result {
+        std::string text;
+        // Lowest glyph score, confident reads reach options.minScore.
+        double confidence = 0.0;
+    };
+
+    TextReader(std::string alphabet, Options options);
+
+    // Glyph sets are stored as glyph_<character code>.png plus reader.yml.
+    static auto load(std::filesystem::path const& directory) -> TextReader;
+    auto save(std::filesystem::path const& directory) const -> void;
+
+    // Adds the field's glyphs to the glyph set, returns false when segmentation disagrees with the label.
+    auto learn(cv::Mat const& field, std::string_view text) -> bool;
+    auto read(cv::Mat const& field) const -> Result;
+
+    auto alphabet() const -> std::string const& { return alphabet_; }
+    auto options() const -> Options const& { return options_; }
+
+private:
+    auto segment(cv::Mat const& field) const -> std::vector<cv::Mat>;
+
+    std::string alphabet_;
+    Options options_;
+    GlyphAtlas glyphs_;
+};
+
+} // namespace oraker
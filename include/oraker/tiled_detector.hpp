@@ -0,0 +1,47 @@
+#pragma once
+
+#include <oraker/detector.hpp>
+#include <oraker/table_regions.hpp>
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace oraker {
+
+// Runs the detector only inside table regions cropped at native scale. Regions larger than the network
+// input are split into overlapping pieces, pieces are shelf-packed into input-sized tiles which go through
+// the network as one batch, and boxes are mapped back to frame coordinates with cross-tile suppression.
+class TiledDetector {
+public:
+    struct Options {
+        int overlap = 64;
+        int spacing = 8;
+        float nmsThreshold = 0.45f;
+    };
+
+    TiledDetector(Detector& detector, std::vector<TableRegion> regions, Options options);
+
+    auto detect(cv::Mat const& frame) -> std::vector<Detection>;
+
+    auto setRegions(std::vector<TableRegion> regions) -> void;
+    auto tileCount() const { return tileCount_; }
+
+private:
+    struct Placement {
+        int tile = 0;
+        cv::Rect source;
+        cv::Point offset;
+    };
+
+    auto plan(cv::Size frameSize) -> void;
+
+    Detector& detector_;
+    std::vector<TableRegion> regions_;
+    Options options_;
+    cv::Size plannedFrameSize_;
+    std::vector<Placement> placements_;
+    int tileCount_ = 0;
+    std::vector<cv::Mat> tiles_;
+};
+
+} // namespace oraker
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace oraker {
+
+// xoshiro256** (Blackman and Vigna): 256 bits of state and a few cycles per number. The state is filled
+// by SplitMix64 from the seed and a stream number, so every (seed, stream) pair gives an unrelated sequence.
+class Xoshiro256 {
+public:
+    using result_type = std::uint64_t;
+
+    explicit constexpr Xoshiro256(std::uint64_t seed, std::uint64_t stream = 0) {
+        auto x = seed ^ splitMix(stream);
+        for (auto& word : state_) {
+            word = splitMix(x);
+            x += GOLDEN;
+        }
+    }
+
+    static constexpr auto min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr auto max() { return std::numeric_limits<result_type>::max(); }
+
+    constexpr auto operator()() -> result_type {
+        auto const result = std::rotl(state_[1] * 5, 7) * 9;
+        auto const t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = std::rotl(state_[3], 45);
+        return result;
+    }
+
+    // Uniform in [0, bound) by multiply-shift; the bias is below bound / 2^32, far under sampling noise.
+    constexpr auto below(std::uint32_t bound) -> std::uint32_t {
+        return static_cast<std::uint32_t>(((*this)() >> 32) * bound >> 32);
+    }
+
+private:
+    static constexpr auto GOLDEN = std::uint64_t{0x9e3779b97f4a7c15};
+
+    static constexpr auto splitMix(std::uint64_t x) -> std::uint64_t {
+        x += GOLDEN;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+        return x ^ (x >> 31);
+    }
+
+    std::uint64_t state_[4]{};
+};
+
+} // namespace oraker
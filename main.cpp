@@ -1,11 +1,32 @@
 #include <ApplicationServices/ApplicationServices.h>
 #include <opencv2/opencv.hpp>
+#include <oraker/amount_reader.hpp>
+#include <oraker/card_recognizer.hpp>
+#include <oraker/detection_tracker.hpp>
+#include <oraker/detector.hpp>
+#include <oraker/frame_conversion.hpp>
+#include <oraker/lru_cache.hpp>
+#include <oraker/mapped_file.hpp>
+#include <oraker/pipeline.hpp>
+#include <oraker/pixel_hash.hpp>
+#include <oraker/seat_names.hpp>
+#include <oraker/seat_signals.hpp>
+#include <oraker/startup_profile.hpp>
+#include <oraker/table_layout.hpp>
+#include <oraker/tiled_detector.hpp>
 #include <algorithm>
 #include <ranges>
 #include <libproc.h>
 #include <span>
 #include <filesystem>
 #include <regex>
+#include <optional>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 auto findSafariPID() {
     static constexpr auto SAFARI_PROCESS_NAME = std::string_view{"Safari"};
@@ -95,11 +116,43 @@ auto SaveCGImageToPNG(CGImageRef image, const std::string &filePath) {
     return success;
 }
 
-auto CGImageToCVMat(CGImageRef image) {
+// Maps a CGImage's bitmap info onto the converter's pixel layouts, empty for layouts it cannot read
+// (float or 16-bit components, alpha-only images).
+auto pixelLayoutOf(CGImageRef image) -> std::optional<oraker::PixelLayout> {
+    auto const bitsPerPixel = CGImageGetBitsPerPixel(image);
+    auto const bitmapInfo = CGImageGetBitmapInfo(image);
+    if (CGImageGetBitsPerComponent(image) != 8 || (bitmapInfo & kCGBitmapFloatComponents) != 0) {
+        return std::nullopt;
+    }
+
+    auto const alphaInfo = CGImageGetAlphaInfo(image);
+    if (bitsPerPixel == 24 && alphaInfo == kCGImageAlphaNone) {
+        return oraker::RGB_LAYOUT;
+    }
+    if (bitsPerPixel != 32 || alphaInfo == kCGImageAlphaNone || alphaInfo == kCGImageAlphaOnly) {
+        return std::nullopt;
+    }
+
+    // Offsets in ARGB or RGBA word order, mirrored when the words are stored little-endian.
+    auto const alphaFirst = alphaInfo == kCGImageAlphaFirst || alphaInfo == kCGImageAlphaPremultipliedFirst || alphaInfo == kCGImageAlphaNoneSkipFirst;
+    auto const littleEndian = (bitmapInfo & kCGBitmapByteOrderMask) == kCGBitmapByteOrder32Little;
+    auto offset = [&](int position) { return littleEndian ? 3 - position : position; };
+    auto const first = alphaFirst ? 1 : 0;
+    auto const skipped = alphaInfo == kCGImageAlphaNoneSkipFirst || alphaInfo == kCGImageAlphaNoneSkipLast;
+    return oraker::PixelLayout{
+        .bytesPerPixel = 4,
+        .red = offset(first),
+        .green = offset(first + 1),
+        .blue = offset(first + 2),
+        .alpha = skipped ? -1 : offset(alphaFirst ? 0 : 3),
+        .premultiplied = alphaInfo == kCGImageAlphaPremultipliedFirst || alphaInfo == kCGImageAlphaPremultipliedLast,
+    };
+}
+
+auto CGImageToCVMat(CGImageRef image, oraker::CaptureConverter const& converter, oraker::ConversionRequest const& request, oraker::ConvertedFrame& frame) {
     // Get image size
     size_t width = CGImageGetWidth(image);
     size_t height = CGImageGetHeight(image);
-    size_t bitsPerComponent = CGImageGetBitsPerComponent(image);
     size_t bitsPerPixel = CGImageGetBitsPerPixel(image);
     size_t bytesPerRow = CGImageGetBytesPerRow(image);
 
@@ -109,23 +162,268 @@ auto CGImageToCVMat(CGImageRef image) {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(CFDataGetBytePtr(dataRef));
 
     // Create a cv::Mat from the raw pixel data
-    cv::Mat mat(height, width, bitsPerPixel == 32 ? CV_8UC4 : CV_8UC3, const_cast<uint8_t*>(data), bytesPerRow);
+    cv::Mat mat(height, width, CV_8UC(bitsPerPixel / 8), const_cast<uint8_t*>(data), bytesPerRow);
 
-    // Convert to BGR format for OpenCV
-    cv::Mat bgrMat;
-    if (bitsPerPixel == 32) {
-        cv::cvtColor(mat, bgrMat, cv::COLOR_RGBA2BGR);
-    } else {
-        bgrMat = mat.clone();
-    }
+    // Convert to the BGR and luma planes consumers asked for, producing the reduced frame in the same pass
+    converter.convert(mat, request, frame);
 
     // Release CFDataRef
     CFRelease(dataRef);
+}
+
+auto findPokerNowWindow(pid_t safariPID) {
+    static constexpr auto POKER_NOW_WINDOW_NAME = std::string_view{"Poker Now - Poker with Friends"};
+
+    auto windowID = std::optional<CGWindowID>{};
+    auto const windowInfos = CGWindowListCopyWindowInfo(kCGWindowListExcludeDesktopElements, kCGNullWindowID);
+    auto const windowInfosCount = CFArrayGetCount(windowInfos);
+    for (CFIndex windowIndex = 0; !windowID && windowIndex < windowInfosCount; ++windowIndex) {
+        auto const windowInfo = reinterpret_cast<CFDictionaryRef>(CFArrayGetValueAtIndex(windowInfos, windowIndex));
+        auto const windowPIDRef = reinterpret_cast<CFNumberRef>(CFDictionaryGetValue(windowInfo, kCGWindowOwnerPID));
+        int windowPID = -1;
+        CFNumberGetValue(windowPIDRef, kCFNumberIntType, &windowPID);
+        if (windowPID != safariPID) {
+            continue;
+        }
+
+        CFStringRef windowNameRef;
+        if (!CFDictionaryGetValueIfPresent(windowInfo, kCGWindowName, reinterpret_cast<void const**>(&windowNameRef))) {
+            continue;
+        }
+        auto const length = CFStringGetLength(windowNameRef);
+        auto const maxSize = CFStringGetMaximumSizeForEncoding(length, kCFStringEncodingUTF8) + 1;
+        auto windowName = std::string(maxSize, '\0');
+        if (!CFStringGetCString(windowNameRef, windowName.data(), maxSize, kCFStringEncodingUTF8)) {
+            std::cerr << "Weren't able to find a window name\n";
+            continue;
+        }
+        if (POKER_NOW_WINDOW_NAME != windowName.c_str()) {
+            continue;
+        }
+
+        auto const windowIDRef = reinterpret_cast<CFNumberRef>(CFDictionaryGetValue(windowInfo, kCGWindowNumber));
+        CGWindowID id = 0;
+        CFNumberGetValue(windowIDRef, kCFNumberIntType, &id);
+        windowID = id;
+    }
+    CFRelease(windowInfos);
+
+    return windowID;
+}
+
+// Frame handle passed between pipeline stages, owned by the pipeline pool and reused.
+struct CapturedFrame {
+    std::size_t index = 0;
+    CGImageRef image = nullptr;
+    oraker::ConvertedFrame planes;
+    std::vector<oraker::Detection> detections;
+    std::shared_ptr<oraker::TableLayout const> layout;
+    // False when conversion failed; planes then hold nothing or an earlier frame.
+    bool converted = false;
+    bool analysed = false;
+};
+
+// Running view of the table, owned by the state stage.
+struct TableState {
+    std::size_t frameIndex = 0;
+    std::vector<oraker::Detection> detections;
+    std::vector<std::optional<oraker::Card>> board;
+    std::optional<double> pot;
+    std::vector<std::optional<double>> stacks;
+    std::vector<oraker::SeatSignalReader::Signals> seats;
+    // Player ID per seat, see PlayerRegistry.
+    std::vector<int> players;
+};
+
+// Readers for the layout's fixed crops. The same cards and stacks reappear on most frames,
+// so results are memoised by the crop's pixel hash.
+struct TableReader {
+    std::optional<oraker::CardRecognizer> cards;
+    std::optional<oraker::AmountReader> amounts;
+    oraker::LruCache<std::uint64_t, std::optional<oraker::Card>, oraker::PixelHashKey> cardCache;
+    oraker::LruCache<std::uint64_t, std::optional<double>, oraker::PixelHashKey> amountCache;
+    oraker::SeatSignalReader signals{{}};
+    std::optional<oraker::SeatNameReader> names{};
+    // Detector fallback for board cards the atlas cannot match, run on the BGR crop. Empty until the model has
+    // loaded; unmatched cards are not cached before then, so they get a second look once it is ready.
+    std::function<std::optional<oraker::Card>(cv::Mat const&)> detectCard{};
+};
+
+// Readers that were not configured are skipped. Glyph matching reads the luma plane, colour signals the BGR one.
+auto readTable(oraker::ConvertedFrame const& frame, oraker::TableLayout const& layout, TableReader& reader, TableState& state) {
+    auto const bounds = cv::Rect{cv::Point{}, frame.size};
+    auto readAmount = [&](cv::Rect const& rect) -> std::optional<double> {
+        auto const area = rect & bounds;
+        if (area.empty()) {
+            return std::nullopt;
+        }
+        auto const field = frame.luma(area);
+        return reader.amountCache.getOrCompute(oraker::hashPixels(field), [&] { return reader.amounts->read(field).value; });
+    };
+
+    state.board.clear();
+    if (reader.cards) {
+        for (auto const& slot : layout.board) {
+            auto const area = slot & bounds;
+            if (area.empty()) {
+                state.board.emplace_back();
+                continue;
+            }
+            auto const roi = frame.luma(area);
+            auto const hash = oraker::hashPixels(roi);
+            if (auto const cached = reader.cardCache.find(hash)) {
+                state.board.push_back(*cached);
+                continue;
+            }
+            auto const card = reader.cards->recognize(roi, [&](cv::Mat const&) {
+                return reader.detectCard ? reader.detectCard(frame.bgr(area)) : std::nullopt;
+            }).card;
+            if (card || reader.detectCard) {
+                reader.cardCache.insert(hash, card);
+            }
+            state.board.push_back(card);
+        }
+    }
+    state.seats = reader.signals.read(frame.bgr, layout);
+    if (reader.names) {
+        state.players = reader.names->update(frame.luma, layout);
+    }
+    state.stacks.clear();
+    if (reader.amounts) {
+        state.pot = readAmount(layout.pot);
+        for (auto const& seat : layout.seats) {
+            state.stacks.push_back(readAmount(seat.stack));
+        }
+    }
+}
 
-    return bgrMat;
+// Boxes are in native frame coordinates and get scaled down to the image, which may be the reduced frame.
+auto drawDetections(cv::Mat& image, std::span<oraker::Detection const> detections, std::span<std::string const> classNames, float scale) {
+    for (auto const& detection : detections) {
+        auto const label = detection.classId < static_cast<int>(classNames.size()) ? classNames[detection.classId] : std::to_string(detection.classId);
+        auto const box = cv::Rect2f{detection.box.x * scale, detection.box.y * scale, detection.box.width * scale, detection.box.height * scale};
+        cv::rectangle(image, box, cv::Scalar{0, 255, 0}, 2);
+        cv::putText(image, label, box.tl(), cv::FONT_HERSHEY_SIMPLEX, scale, cv::Scalar{0, 255, 0}, 2);
+    }
+}
+
+auto drawLayout(cv::Mat& image, oraker::TableLayout const& layout, float scale) {
+    for (auto const& region : layout.regions()) {
+        auto const rect = cv::Rect{cv::Rect2f{region.rect.x * scale, region.rect.y * scale, region.rect.width * scale, region.rect.height * scale}};
+        cv::rectangle(image, rect, cv::Scalar{255, 128, 0}, 1);
+    }
 }
 
-int main() {
+int main(int argc, char** argv) {
+    auto startup = oraker::StartupProfile{};
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h     |      | print this message}"
+        "{model      |      | YOLOv8 ONNX model, enables detection on every captured frame}"
+        "{names      |      | class names file, one name per line}"
+        "{tiled      |      | detect only inside table regions cropped at native resolution}"
+        "{regions    |      | table regions file for tiled mode, regions are learned when omitted}"
+        "{learn      | 10   | full-frame passes used to learn table regions in tiled mode}"
+        "{batch      | 1    | tiles per forward pass, the model must be exported with dynamic=True above 1}"
+        "{track      |      | reuse detections while tracked regions stay unchanged}"
+        "{refresh    | 30   | frames after which tracking re-runs detection regardless of changes}"
+        "{layouts    |      | table layouts file keyed by window size, missing sizes are calibrated from detections and added}"
+        "{atlas      |      | card glyph atlas directory, reads the board through the table layout}"
+        "{amounts    |      | amount glyph set directory, reads pot and stacks through the table layout}"
+        "{players    |      | player name glyph set directory, maps seat names to stable player IDs}"
+        "{cache      | 4096 | recognition results cached per reader, keyed by ROI pixel hash}"
+        "{scale      | 2    | reduced frame scale (1, 2 or 4) for change detection, deduplication and preview}"
+        "{dedup      |      | skip saving frames identical to the previously saved one}"
+        "{queue-depth| 2    | frames buffered between consecutive pipeline stages}"
+        "{step       |      | wait for a key press after every previewed frame}"};
+    if (parser.has("help")) {
+        parser.printMessage();
+        return 0;
+    }
+
+    // The model loads in the background so capture starts immediately, frames are analysed once it is ready.
+    auto modelLoad = std::future<oraker::Detector>{};
+    if (parser.has("model")) {
+        auto options = oraker::Detector::Options{.modelPath = parser.get<std::string>("model"), .maxBatch = parser.get<int>("batch")};
+        modelLoad = std::async(std::launch::async, [&startup, options] {
+            auto const model = startup.measure("map model", [&] { return oraker::MappedFile{options.modelPath}; });
+            auto detector = startup.measure("parse model", [&] { return oraker::Detector{options, model.bytes()}; });
+            startup.measure("warm-up inference", [&] { detector.warmUp(); });
+            return detector;
+        });
+    }
+
+    auto detector = std::optional<oraker::Detector>{};
+    // The detect stage publishes the loaded detector to the state stage, whose card fallback shares it under the mutex.
+    auto detectorLoaded = std::atomic<bool>{false};
+    auto detectorMutex = std::mutex{};
+    auto tiledDetector = std::optional<oraker::TiledDetector>{};
+    auto regionLearner = oraker::RegionLearner{};
+    auto learningFrames = parser.get<int>("learn");
+    auto classNames = parser.has("names") ? oraker::loadClassNames(parser.get<std::string>("names")) : std::vector<std::string>{};
+    auto onDetectorLoaded = [&](oraker::Detector loaded) {
+        detector.emplace(std::move(loaded));
+        if (parser.has("tiled")) {
+            auto regions = parser.has("regions") ? oraker::loadRegions(parser.get<std::string>("regions")) : std::vector<oraker::TableRegion>{};
+            learningFrames = regions.empty() ? learningFrames : 0;
+            tiledDetector.emplace(*detector, std::move(regions), oraker::TiledDetector::Options{});
+        }
+    };
+
+    // Table geometry is calibrated once per window size and persisted, afterwards every frame is read through fixed crops.
+    auto const layoutsPath = parser.has("layouts") ? std::filesystem::path{parser.get<std::string>("layouts")} : std::filesystem::path{};
+    auto layouts = !layoutsPath.empty() && std::filesystem::exists(layoutsPath) ? oraker::loadLayouts(layoutsPath) : std::vector<oraker::TableLayout>{};
+    auto calibrator = oraker::LayoutCalibrator{classNames, {.frames = parser.get<int>("learn")}};
+    auto layout = std::shared_ptr<oraker::TableLayout const>{};
+    auto useLayout = [&](oraker::TableLayout found) {
+        layout = std::make_shared<oraker::TableLayout const>(std::move(found));
+        if (tiledDetector) {
+            learningFrames = 0;
+            tiledDetector->setRegions(layout->regions());
+        }
+    };
+    auto const cacheEntries = static_cast<std::size_t>(parser.get<int>("cache"));
+    auto tableReader = TableReader{
+        parser.has("atlas") ? std::optional{oraker::CardRecognizer::load(parser.get<std::string>("atlas"))} : std::nullopt,
+        parser.has("amounts") ? std::optional{oraker::AmountReader::load(parser.get<std::string>("amounts"))} : std::nullopt,
+        decltype(TableReader::cardCache){cacheEntries},
+        decltype(TableReader::amountCache){cacheEntries}};
+    auto players = oraker::PlayerRegistry{};
+    if (parser.has("players")) {
+        tableReader.names.emplace(oraker::TextReader::load(parser.get<std::string>("players")), players, cacheEntries);
+    }
+
+    auto tableState = TableState{};
+    auto tracker = std::optional<oraker::DetectionTracker>{};
+    if (parser.has("track")) {
+        tracker.emplace(oraker::DetectionTracker::Options{.refreshInterval = parser.get<int>("refresh")});
+    }
+
+    auto detect = [&](cv::Mat const& frame) {
+        if (!layoutsPath.empty() && !layout) {
+            auto detections = detector->detect(frame);
+            calibrator.observe(detections, frame.size());
+            if (calibrator.ready()) {
+                if (auto calibrated = calibrator.layout()) {
+                    layouts.push_back(*calibrated);
+                    oraker::saveLayouts(layoutsPath, layouts);
+                    useLayout(std::move(*calibrated));
+                }
+            }
+            return detections;
+        }
+        if (tiledDetector && learningFrames == 0) {
+            return tiledDetector->detect(frame);
+        }
+        auto detections = detector->detect(frame);
+        if (tiledDetector) {
+            regionLearner.observe(detections, frame.size());
+            if (--learningFrames == 0) {
+                tiledDetector->setRegions(regionLearner.regions());
+            }
+        }
+        return detections;
+    };
+
     constexpr auto versionDirectoryName = std::string_view{"ver"};
     constexpr auto assetsDirectory = std::string_view{"./assets"};
 
@@ -136,56 +434,173 @@ int main() {
     assert(std::filesystem::create_directory(newVersionPath));
 
     auto const safariPID = findSafariPID();
-    int keyCode = -1;
-
-    do {
-        auto const windowInfos = CGWindowListCopyWindowInfo(kCGWindowListExcludeDesktopElements, kCGNullWindowID);
-        auto const windowInfosCount = CFArrayGetCount(windowInfos);
-        for (CFIndex windowIndex = 0; windowIndex < windowInfosCount; ++windowIndex) {
-            auto const windowInfo = reinterpret_cast<CFDictionaryRef>(CFArrayGetValueAtIndex(windowInfos, windowIndex));
-            auto const windowPIDRef = reinterpret_cast<CFNumberRef>(CFDictionaryGetValue(windowInfo, kCGWindowOwnerPID));
-            int windowPID = -1;
-            CFNumberGetValue(windowPIDRef, kCFNumberIntType, &windowPID);
-            if (windowPID != safariPID) {
-                continue;
-            }
-
-            CFStringRef windowNameRef;
-            if (CFDictionaryGetValueIfPresent(windowInfo, kCGWindowName, reinterpret_cast<void const**>(&windowNameRef))) {
-                auto const length = CFStringGetLength(windowNameRef);
-                auto const maxSize = CFStringGetMaximumSizeForEncoding(length, kCFStringEncodingUTF8) + 1;
-                char* windowName = new char[maxSize];
-                if (!CFStringGetCString(windowNameRef, windowName, maxSize, kCFStringEncodingUTF8)) {
-                    std::cerr << "Weren't able to find a window name\n";
-                    continue;
-                }
-
-                if (strcmp(windowName, "Poker Now - Poker with Friends") != 0) {
-                    delete[] windowName;
-                    continue;
+    auto const stepping = parser.has("step");
+    auto firstFrameCaptured = false;
+    auto firstFrameAnalysed = false;
+
+    // Capture of frame N + 1 overlaps conversion, detection and saving of the frames before it.
+    auto pipeline = oraker::Pipeline<CapturedFrame>{static_cast<std::size_t>(parser.get<int>("queue-depth"))};
+    pipeline.addStage("capture", [&](CapturedFrame& frame) {
+        // A missing window or a failed capture (window off-screen, space switch) is waited out.
+        while (true) {
+            if (auto const windowID = findPokerNowWindow(safariPID)) {
+                frame.image = CGWindowListCreateImage(CGRectNull, kCGWindowListOptionIncludingWindow, *windowID, kCGWindowImageBestResolution);
+                if (frame.image != nullptr) {
+                    break;
                 }
-
-                auto const windowIDRef = reinterpret_cast<CFNumberRef>(CFDictionaryGetValue(windowInfo, kCGWindowNumber));
-                CGWindowID windowID = 0;
-                CFNumberGetValue(windowIDRef, kCFNumberIntType, &windowID);
-                auto const windowScreenShotRef = CGWindowListCreateImage(CGRectNull, kCGWindowListOptionIncludingWindow, windowID, kCGWindowImageBestResolution);
-
-                SaveCGImageToPNG(windowScreenShotRef, newVersionPath.native() + "/" + std::to_string(++imageIndex) + ".png");
-
-                auto mat = CGImageToCVMat(windowScreenShotRef);
-                cv::imshow("Test Image", mat);
-                keyCode = cv::waitKey(0);
-
-                delete[] windowName;
-                break;
             }
+            if (pipeline.stopRequested()) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{100});
         }
-
-        if (keyCode == 113) {
-            break;
+        frame.index = ++imageIndex;
+        if (!firstFrameCaptured) {
+            firstFrameCaptured = true;
+            startup.mark("first frame captured");
         }
-
-    } while (true);
+        return true;
+    });
+    // Cards and amounts are read from the native frame, everything that only compares or shows whole frames uses the reduced one.
+    // Consumers declare the planes they read, so 3-channel colour is only produced for the detector, seat signals and preview.
+    auto const deduplicate = parser.has("dedup");
+    auto conversion = oraker::ConversionRequest{.native = {}, .reduced = {.bgr = true}, .reducedScale = parser.get<int>("scale")};
+    if (parser.has("model")) {
+        conversion.native = conversion.native | oraker::Detector::FRAME_FORMATS;
+    }
+    if (!layoutsPath.empty()) {
+        conversion.native = conversion.native | oraker::SeatSignalReader::FRAME_FORMATS;
+    }
+    if (tableReader.cards) {
+        conversion.native = conversion.native | oraker::CardRecognizer::FRAME_FORMATS;
+    }
+    if (tableReader.amounts) {
+        conversion.native = conversion.native | oraker::AmountReader::FRAME_FORMATS;
+    }
+    if (tableReader.names) {
+        conversion.native = conversion.native | oraker::SeatNameReader::FRAME_FORMATS;
+    }
+    if (tracker) {
+        conversion.reduced = conversion.reduced | oraker::DetectionTracker::FRAME_FORMATS;
+    }
+    if (deduplicate) {
+        conversion.reduced.luma = true;
+    }
+    auto lastSavedHash = std::optional<std::uint64_t>{};
+    // Conversion kernels are picked once per source layout, not per frame.
+    auto converter = std::optional<oraker::CaptureConverter>{};
+    pipeline.addStage("convert", [&](CapturedFrame& frame) {
+        frame.converted = false;
+        auto const pixelLayout = pixelLayoutOf(frame.image);
+        if (!pixelLayout) {
+            std::cerr << "Unsupported capture pixel format\n";
+            return false;
+        }
+        if (!converter || converter->layout() != *pixelLayout) {
+            converter.emplace(*pixelLayout);
+        }
+        CGImageToCVMat(frame.image, *converter, conversion, frame.planes);
+        frame.converted = true;
+        return true;
+    });
+    pipeline.addStage("detect", [&](CapturedFrame& frame) {
+        if (!frame.converted) {
+            return true;
+        }
+        if (!layoutsPath.empty() && (!layout || layout->windowSize != frame.planes.size)) {
+            if (layout) {
+                std::cerr << "Window resized to " << frame.planes.size << ", switching table layout\n";
+                layout.reset();
+            }
+            if (auto known = oraker::findLayout(layouts, frame.planes.size)) {
+                useLayout(std::move(*known));
+            }
+        }
+        frame.layout = layout;
+        if (!detector && modelLoad.valid() && modelLoad.wait_for(std::chrono::seconds{0}) == std::future_status::ready) {
+            onDetectorLoaded(modelLoad.get());
+            detectorLoaded.store(true, std::memory_order_release);
+        }
+        if (detector) {
+            auto const lock = std::scoped_lock{detectorMutex};
+            frame.detections = tracker ? tracker->process(frame.planes.bgr, frame.planes.reducedLuma, detect) : detect(frame.planes.bgr);
+        }
+        frame.analysed = detector || !parser.has("model");
+        return true;
+    });
+    pipeline.addStage("state", [&](CapturedFrame& frame) {
+        if (!frame.converted) {
+            return true;
+        }
+        tableState.frameIndex = frame.index;
+        tableState.detections = frame.detections;
+        if (tableReader.cards && !tableReader.detectCard && detectorLoaded.load(std::memory_order_acquire)) {
+            tableReader.detectCard = [&](cv::Mat const& bgr) {
+                auto const lock = std::scoped_lock{detectorMutex};
+                return oraker::detectCard(*detector, bgr, classNames);
+            };
+        }
+        if (frame.layout) {
+            readTable(frame.planes, *frame.layout, tableReader, tableState);
+        }
+        if (frame.analysed && !firstFrameAnalysed) {
+            firstFrameAnalysed = true;
+            startup.mark("first frame analysed");
+            startup.report(std::cout);
+        }
+        return true;
+    });
+    pipeline.addStage("save", [&](CapturedFrame& frame) {
+        auto const hash = deduplicate && frame.converted ? std::optional{oraker::hashPixels(frame.planes.reducedLuma)} : std::nullopt;
+        if (!hash || hash != lastSavedHash) {
+            SaveCGImageToPNG(frame.image, newVersionPath.native() + "/" + std::to_string(frame.index) + ".png");
+            lastSavedHash = hash;
+        }
+        CGImageRelease(frame.image);
+        frame.image = nullptr;
+        return true;
+    });
+    pipeline.addStage("preview", [&](CapturedFrame& frame) {
+        if (!frame.converted) {
+            return true;
+        }
+        auto& preview = frame.planes.reducedBgr;
+        auto const scale = static_cast<float>(preview.cols) / frame.planes.size.width;
+        drawDetections(preview, frame.detections, classNames, scale);
+        if (frame.layout) {
+            drawLayout(preview, *frame.layout, scale);
+        }
+        cv::imshow("Test Image", preview);
+        auto const keyCode = cv::waitKey(stepping ? 0 : 1);
+        return keyCode != 113;
+    });
+    startup.mark("pipeline started");
+    pipeline.run();
+
+    for (auto const& stage : pipeline.statistics()) {
+        std::cout << stage.name << ": " << stage.frames << " frames, " << stage.busySeconds << " s busy, "
+                  << 100.0 * stage.utilisation << "% utilisation\n";
+    }
+    auto reportCache = [](std::string_view name, auto const& cache) {
+        auto const& statistics = cache.statistics();
+        std::cout << name << " cache: " << 100.0 * statistics.hitRate() << "% hits, " << cache.size() << " entries, "
+                  << cache.memoryFootprint() / 1024 << " KiB, " << statistics.evictions << " evictions\n";
+    };
+    if (tableReader.cards) {
+        reportCache("Card", tableReader.cardCache);
+    }
+    if (tableReader.amounts) {
+        reportCache("Amount", tableReader.amountCache);
+    }
+    if (tableReader.names) {
+        auto const& statistics = tableReader.names->statistics();
+        std::cout << "Players: " << players.size() << " registered, names read " << statistics.reads << " times in "
+                  << statistics.checks << " seat checks\n";
+    }
+    if (tracker) {
+        auto const& statistics = tracker->statistics();
+        std::cout << "Inference skipped on " << statistics.skipped << " of " << statistics.frames << " frames\n";
+    }
 
     return 0;
 }
@@ -0,0 +1,69 @@
+#include <oraker/amount_reader.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+
+namespace oraker {
+
+AmountReader::AmountReader(Options options)
+    : text_{std::string{ALPHABET}, options} {
+}
+
+AmountReader::AmountReader(TextReader text)
+    : text_{std::move(text)} {
+}
+
+auto AmountReader::load(std::filesystem::path const& directory) -> AmountReader {
+    return AmountReader{TextReader::load(directory)};
+}
+
+auto AmountReader::save(std::filesystem::path const& directory) const -> void {
+    text_.save(directory);
+}
+
+auto AmountReader::learn(cv::Mat const& field, std::string_view text) -> bool {
+    return text_.learn(field, text);
+}
+
+auto AmountReader::read(cv::Mat const& field) const -> Result {
+    auto const text = text_.read(field);
+    auto result = Result{text.text, std::nullopt, text.confidence};
+    if (!result.text.empty() && result.confidence >= text_.options().minScore) {
+        result.value = parseAmount(result.text);
+    }
+    return result;
+}
+
+auto parseAmount(std::string_view text) -> std::optional<double> {
+    auto multiplier = 1.0;
+    if (!text.empty()) {
+        switch (text.back()) {
+        case 'k':
+        case 'K':
+            multiplier = 1e3;
+            break;
+        case 'M':
+            multiplier = 1e6;
+            break;
+        case 'B':
+            multiplier = 1e9;
+            break;
+        }
+        if (multiplier != 1.0) {
+            text.remove_suffix(1);
+        }
+    }
+
+    auto digits = std::string{};
+    std::ranges::copy_if(text, std::back_inserter(digits), [](char c) { return c != ','; });
+    auto const isDigit = [](char c) { return c >= '0' && c <= '9'; };
+    // A lone dot is OCR noise, not an amount of 0.
+    if (!std::ranges::any_of(digits, isDigit) || std::ranges::count(digits, '.') > 1
+        || !std::ranges::all_of(digits, [&](char c) { return c == '.' || isDigit(c); })) {
+        return std::nullopt;
+    }
+    return std::strtod(digits.c_str(), nullptr) * multiplier;
+}
+
+} // namespace oraker
@@ -0,0 +1,187 @@
+#include <oraker/card_recognizer.hpp>
+#include <oraker/luma.hpp>
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace oraker {
+
+namespace {
+
+auto glyphRect(cv::Size roiSize, cv::Rect2f const& fraction) {
+    auto const rect = cv::Rect{
+        cvRound(fraction.x * roiSize.width), cvRound(fraction.y * roiSize.height),
+        cvRound(fraction.width * roiSize.width), cvRound(fraction.height * roiSize.height)};
+    return rect & cv::Rect{cv::Point{}, roiSize};
+}
+
+} // namespace
+
+GlyphAtlas::GlyphAtlas(cv::Size glyphSize)
+    : glyphSize_{glyphSize} {
+}
+
+auto GlyphAtlas::normalise(cv::Mat const& glyph) const -> cv::Mat {
+    cv::Mat resized;
+    cv::resize(toLuma(glyph), resized, glyphSize_, 0, 0, cv::INTER_AREA);
+
+    cv::Mat row;
+    resized.reshape(1, 1).convertTo(row, CV_32F);
+    row -= cv::mean(row);
+    auto const norm = cv::norm(row);
+    if (norm > 1e-6) {
+        row /= norm;
+    }
+    return row;
+}
+
+auto GlyphAtlas::addSample(int label, cv::Mat const& glyph) -> void {
+    auto const sample = normalise(glyph);
+    auto const it = std::ranges::find(labels_, label);
+    auto const index = static_cast<int>(it - labels_.begin());
+    if (it == labels_.end()) {
+        labels_.push_back(label);
+        sums_.push_back(cv::Mat::zeros(sample.size(), CV_32F));
+        counts_.push_back(0);
+
+        auto templates = cv::Mat{static_cast<int>(labels_.size()), sample.cols, CV_32F, cv::Scalar{0}};
+        if (!templates_.empty()) {
+            templates_.copyTo(templates.rowRange(0, templates_.rows));
+        }
+        templates_ = templates;
+    }
+
+    sums_[index] += sample;
+    ++counts_[index];
+
+    auto averaged = cv::Mat{sums_[index] / counts_[index]};
+    averaged -= cv::mean(averaged);
+    auto const norm = cv::norm(averaged);
+    if (norm > 1e-6) {
+        averaged /= norm;
+    }
+    averaged.copyTo(templates_.row(index));
+}
+
+auto GlyphAtlas::match(cv::Mat const& glyph) const -> Match {
+    if (labels_.empty() || glyph.empty()) {
+        return {};
+    }
+
+    // Rows are zero-mean and unit-norm, so each dot product is the correlation coefficient.
+    auto const sample = normalise(glyph);
+    auto const scores = cv::Mat{templates_ * sample.t()};
+
+    auto match = Match{};
+    auto secondScore = -1.0;
+    for (auto index = 0; index < scores.rows; ++index) {
+        auto const score = static_cast<double>(scores.at<float>(index));
+        if (score > match.score) {
+            secondScore = match.score;
+            match = {labels_[index], score};
+        } else if (score > secondScore) {
+            secondScore = score;
+        }
+    }
+    match.margin = match.score - secondScore;
+    return match;
+}
+
+auto GlyphAtlas::templateImage(int label) const -> cv::Mat {
+    auto const it = std::ranges::find(labels_, label);
+    if (it == labels_.end()) {
+        return {};
+    }
+    cv::Mat image;
+    cv::normalize(templates_.row(static_cast<int>(it - labels_.begin())).reshape(1, glyphSize_.height), image, 0, 255, cv::NORM_MINMAX, CV_8U);
+    return image;
+}
+
+CardRecognizer::CardRecognizer(Options options)
+    : options_{options}
+    , ranks_{options.glyphSize}
+    , suits_{options.glyphSize} {
+}
+
+auto CardRecognizer::load(std::filesystem::path const& directory) -> CardRecognizer {
+    auto storage = cv::FileStorage{(directory / "layout.yml").string(), cv::FileStorage::READ};
+    if (!storage.isOpened()) {
+        throw std::runtime_error("Failed to open glyph atlas layout in " + directory.string());
+    }
+    auto options = Options{};
+    storage["rank"] >> options.layout.rank;
+    storage["suit"] >> options.layout.suit;
+    storage["glyphSize"] >> options.glyphSize;
+    storage["minScore"] >> options.minScore;
+    storage["minMargin"] >> options.minMargin;
+
+    auto recognizer = CardRecognizer{options};
+    for (auto rank = 0; rank < static_cast<int>(Card::RANKS.size()); ++rank) {
+        auto const glyph = cv::imread((directory / ("rank_" + std::string{Card::RANKS[rank]} + ".png")).string(), cv::IMREAD_GRAYSCALE);
+        if (!glyph.empty()) {
+            recognizer.ranks_.addSample(rank, glyph);
+        }
+    }
+    for (auto suit = 0; suit < static_cast<int>(Card::SUITS.size()); ++suit) {
+        auto const glyph = cv::imread((directory / ("suit_" + std::string{Card::SUITS[suit]} + ".png")).string(), cv::IMREAD_GRAYSCALE);
+        if (!glyph.empty()) {
+            recognizer.suits_.addSample(suit, glyph);
+        }
+    }
+    return recognizer;
+}
+
+auto CardRecognizer::save(std::filesystem::path const& directory) const -> void {
+    std::filesystem::create_directories(directory);
+    auto storage = cv::FileStorage{(directory / "layout.yml").string(), cv::FileStorage::WRITE};
+    storage << "rank" << options_.layout.rank << "suit" << options_.layout.suit << "glyphSize" << options_.glyphSize
+            << "minScore" << options_.minScore << "minMargin" << options_.minMargin;
+
+    for (auto const rank : ranks_.labels()) {
+        cv::imwrite((directory / ("rank_" + std::string{Card::RANKS[rank]} + ".png")).string(), ranks_.templateImage(rank));
+    }
+    for (auto const suit : suits_.labels()) {
+        cv::imwrite((directory / ("suit_" + std::string{Card::SUITS[suit]} + ".png")).string(), suits_.templateImage(suit));
+    }
+}
+
+auto CardRecognizer::learn(cv::Mat const& cardRoi, Card card) -> void {
+    ranks_.addSample(card.rank(), cardRoi(glyphRect(cardRoi.size(), options_.layout.rank)));
+    suits_.addSample(card.suit(), cardRoi(glyphRect(cardRoi.size(), options_.layout.suit)));
+}
+
+auto CardRecognizer::recognize(cv::Mat const& cardRoi) const -> Result {
+    auto const rank = ranks_.match(cardRoi(glyphRect(cardRoi.size(), options_.layout.rank)));
+    auto const suit = suits_.match(cardRoi(glyphRect(cardRoi.size(), options_.layout.suit)));
+
+    auto result = Result{std::nullopt, std::min(rank.score, suit.score)};
+    auto const confident = result.confidence >= options_.minScore && std::min(rank.margin, suit.margin) >= options_.minMargin;
+    if (confident && rank.label >= 0 && suit.label >= 0) {
+        result.card = Card{rank.label, suit.label};
+    }
+    return result;
+}
+
+auto detectCard(Detector& detector, cv::Mat const& cardRoi, std::span<std::string const> classNames) -> std::optional<Card> {
+    auto const input = detector.options().inputSize;
+    auto const detections = cardRoi.cols <= input.width && cardRoi.rows <= input.height
+        ? std::move(detector.detectTiles(std::span{&cardRoi, 1}).front())
+        : detector.detect(cardRoi);
+
+    auto best = std::optional<Card>{};
+    auto bestConfidence = 0.0f;
+    for (auto const& detection : detections) {
+        if (detection.classId < 0 || detection.classId >= static_cast<int>(classNames.size()) || detection.confidence <= bestConfidence) {
+            continue;
+        }
+        if (auto const card = Card::parse(classNames[detection.classId])) {
+            best = card;
+            bestConfidence = detection.confidence;
+        }
+    }
+    return best;
+}
+
+} // namespace oraker
@@ -0,0 +1,118 @@
+#include <oraker/detection_metrics.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace oraker {
+
+auto iouThreshold(std::size_t thresholdIndex) -> float {
+    return 0.5f + 0.05f * static_cast<float>(thresholdIndex);
+}
+
+DetectionMetrics::DetectionMetrics(int classCount)
+    : predictions_(classCount)
+    , truthCounts_(classCount, 0) {
+}
+
+auto DetectionMetrics::addImage(std::span<Detection const> predictions, std::span<GroundTruth const> truths) -> void {
+    for (auto const& truth : truths) {
+        if (truth.classId >= 0 && truth.classId < static_cast<int>(truthCounts_.size())) {
+            ++truthCounts_[truth.classId];
+        }
+    }
+
+    auto order = std::vector<std::size_t>(predictions.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, std::greater{}, [&](auto index) { return predictions[index].confidence; });
+
+    // Greedy matching in confidence order, independently for every IoU threshold.
+    auto matched = std::vector<std::array<bool, IOU_THRESHOLDS>>(truths.size());
+    for (auto const index : order) {
+        auto const& detection = predictions[index];
+        if (detection.classId < 0 || detection.classId >= static_cast<int>(predictions_.size())) {
+            continue;
+        }
+
+        auto prediction = Prediction{detection.confidence};
+        for (auto threshold = std::size_t{0}; threshold < IOU_THRESHOLDS; ++threshold) {
+            auto best = truths.size();
+            auto bestIou = iouThreshold(threshold);
+            for (auto truth = std::size_t{0}; truth < truths.size(); ++truth) {
+                if (matched[truth][threshold] || truths[truth].classId != detection.classId) {
+                    continue;
+                }
+                auto const iou = intersectionOverUnion(detection.box, truths[truth].box);
+                if (iou >= bestIou) {
+                    best = truth;
+                    bestIou = iou;
+                }
+            }
+            if (best < truths.size()) {
+                matched[best][threshold] = true;
+                prediction.truePositive[threshold] = true;
+            }
+        }
+        predictions_[detection.classId].push_back(prediction);
+    }
+}
+
+auto DetectionMetrics::averagePrecision(int classId, std::size_t thresholdIndex) const -> double {
+    auto const truthCount = truthCounts_[classId];
+    if (truthCount == 0) {
+        return 0.0;
+    }
+
+    auto predictions = predictions_[classId];
+    std::ranges::stable_sort(predictions, std::greater{}, &Prediction::confidence);
+
+    auto recall = std::vector<double>{};
+    auto precision = std::vector<double>{};
+    auto truePositives = std::size_t{0};
+    for (auto index = std::size_t{0}; index < predictions.size(); ++index) {
+        truePositives += predictions[index].truePositive[thresholdIndex];
+        recall.push_back(static_cast<double>(truePositives) / truthCount);
+        precision.push_back(static_cast<double>(truePositives) / (index + 1));
+    }
+
+    // Precision envelope, then sample it at 101 recall points.
+    for (auto index = precision.size(); index-- > 1;) {
+        precision[index - 1] = std::max(precision[index - 1], precision[index]);
+    }
+    auto sum = 0.0;
+    for (auto point = 0; point <= 100; ++point) {
+        auto const it = std::ranges::lower_bound(recall, point / 100.0);
+        if (it != recall.end()) {
+            sum += precision[it - recall.begin()];
+        }
+    }
+    return sum / 101.0;
+}
+
+auto DetectionMetrics::meanAveragePrecision50() const -> double {
+    auto sum = 0.0;
+    auto classes = 0;
+    for (auto classId = 0; classId < static_cast<int>(truthCounts_.size()); ++classId) {
+        if (truthCounts_[classId] > 0) {
+            sum += averagePrecision(classId, 0);
+            ++classes;
+        }
+    }
+    return classes == 0 ? 0.0 : sum / classes;
+}
+
+auto DetectionMetrics::meanAveragePrecision50To95() const -> double {
+    auto sum = 0.0;
+    auto classes = 0;
+    for (auto classId = 0; classId < static_cast<int>(truthCounts_.size()); ++classId) {
+        if (truthCounts_[classId] == 0) {
+            continue;
+        }
+        for (auto threshold = std::size_t{0}; threshold < IOU_THRESHOLDS; ++threshold) {
+            sum += averagePrecision(classId, threshold) / IOU_THRESHOLDS;
+        }
+        ++classes;
+    }
+    return classes == 0 ? 0.0 : sum / classes;
+}
+
+} // namespace oraker
@@ -0,0 +1,100 @@
+#include <oraker/detection_tracker.hpp>
+#include <oraker/luma.hpp>
+
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+
+namespace oraker {
+
+namespace {
+
+auto meanAbsoluteDifference(cv::Mat const& lhs, cv::Mat const& rhs) {
+    return cv::norm(lhs, rhs, cv::NORM_L1) / static_cast<double>(lhs.total());
+}
+
+} // namespace
+
+DetectionTracker::DetectionTracker(Options options)
+    : options_{options} {
+}
+
+auto DetectionTracker::thumbnail(cv::Mat const& view, cv::Rect2f const& box, cv::Size size) const -> cv::Mat {
+    auto const scaleX = static_cast<float>(view.cols) / frameSize_.width;
+    auto const scaleY = static_cast<float>(view.rows) / frameSize_.height;
+    auto const scaled = cv::Rect2f{box.x * scaleX, box.y * scaleY, box.width * scaleX, box.height * scaleY};
+    auto const area = cv::Rect{scaled} & cv::Rect{cv::Point{}, view.size()};
+    if (area.empty()) {
+        return {};
+    }
+
+    cv::Mat result;
+    cv::resize(toLuma(view(area)), result, size, 0, 0, cv::INTER_AREA);
+    return result;
+}
+
+auto DetectionTracker::needsDetection(cv::Mat const& view, cv::Size frameSize) -> bool {
+    if (frameAppearance_.empty() || frameSize != frameSize_ || view.size() != viewSize_ || framesSinceDetection_ >= options_.refreshInterval) {
+        return true;
+    }
+
+    // The coarse frame thumbnail catches objects appearing outside of tracked boxes, e.g. a new board card.
+    auto const frameAppearance = thumbnail(view, cv::Rect2f{cv::Point2f{}, cv::Size2f{frameSize}}, options_.frameThumbnailSize);
+    if (meanAbsoluteDifference(frameAppearance, frameAppearance_) > options_.changeThreshold) {
+        return true;
+    }
+
+    return std::ranges::any_of(tracks_, [&](auto const& track) {
+        auto const appearance = thumbnail(view, track.detection.box, options_.thumbnailSize);
+        return appearance.empty() || meanAbsoluteDifference(appearance, track.appearance) > options_.changeThreshold;
+    });
+}
+
+auto DetectionTracker::update(cv::Mat const& view, cv::Size frameSize, std::vector<Detection> const& detections) -> void {
+    frameSize_ = frameSize;
+    viewSize_ = view.size();
+    auto previous = std::move(tracks_);
+    auto matched = std::vector<bool>(previous.size(), false);
+
+    tracks_.clear();
+    for (auto const& detection : detections) {
+        auto appearance = thumbnail(view, detection.box, options_.thumbnailSize);
+        if (appearance.empty()) {
+            continue;
+        }
+
+        auto best = previous.size();
+        auto bestIou = options_.matchIou;
+        for (auto index = std::size_t{0}; index < previous.size(); ++index) {
+            auto const& track = previous[index];
+            if (matched[index] || track.detection.classId != detection.classId) {
+                continue;
+            }
+            auto const iou = intersectionOverUnion(track.detection.box, detection.box);
+            if (iou >= bestIou && meanAbsoluteDifference(appearance, track.appearance) <= options_.changeThreshold) {
+                best = index;
+                bestIou = iou;
+            }
+        }
+
+        if (best < previous.size()) {
+            matched[best] = true;
+            tracks_.push_back({previous[best].id, detection, std::move(appearance), previous[best].age + 1});
+        } else {
+            tracks_.push_back({nextId_++, detection, std::move(appearance), 0});
+        }
+    }
+
+    frameAppearance_ = thumbnail(view, cv::Rect2f{cv::Point2f{}, cv::Size2f{frameSize}}, options_.frameThumbnailSize);
+    framesSinceDetection_ = 0;
+}
+
+auto DetectionTracker::detections() const -> std::vector<Detection> {
+    auto result = std::vector<Detection>{};
+    result.reserve(tracks_.size());
+    std::ranges::copy(tracks_ | std::views::transform(&Track::detection), std::back_inserter(result));
+    return result;
+}
+
+} // namespace oraker
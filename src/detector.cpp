@@ -0,0 +1,154 @@
+#include <oraker/detector.hpp>
+#include <oraker/mapped_file.hpp>
+
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace oraker {
+
+namespace {
+
+auto const PADDING_COLOR = cv::Scalar{114, 114, 114};
+
+auto padToInput(cv::Mat const& image, cv::Size inputSize) {
+    if (image.size() == inputSize) {
+        return image;
+    }
+    cv::Mat padded;
+    cv::copyMakeBorder(image, padded, 0, inputSize.height - image.rows, 0, inputSize.width - image.cols, cv::BORDER_CONSTANT, PADDING_COLOR);
+    return padded;
+}
+
+} // namespace
+
+Detector::Detector(Options options)
+    : Detector{options, MappedFile{options.modelPath}.bytes()} {
+}
+
+Detector::Detector(Options options, std::span<std::byte const> model)
+    : options_{std::move(options)}
+    , net_{cv::dnn::readNetFromONNX(reinterpret_cast<char const*>(model.data()), model.size())} {
+    if (net_.empty()) {
+        throw std::runtime_error("Failed to load detector model " + options_.modelPath.string());
+    }
+    options_.maxBatch = std::max(options_.maxBatch, 1);
+}
+
+auto Detector::warmUp() -> void {
+    auto const frame = cv::Mat{options_.inputSize, CV_8UC3, PADDING_COLOR};
+    forward(std::span{&frame, 1});
+}
+
+auto Detector::detect(cv::Mat const& frame) -> std::vector<Detection> {
+    auto const scale = std::min(static_cast<double>(options_.inputSize.width) / frame.cols, static_cast<double>(options_.inputSize.height) / frame.rows);
+    cv::Mat resized;
+    cv::resize(frame, resized, cv::Size{}, scale, scale, cv::INTER_AREA);
+    resized = padToInput(resized, options_.inputSize);
+
+    auto detections = std::move(forward(std::span{&resized, 1}).front());
+    for (auto& detection : detections) {
+        detection.box = cv::Rect2f{
+            static_cast<float>(detection.box.x / scale), static_cast<float>(detection.box.y / scale),
+            static_cast<float>(detection.box.width / scale), static_cast<float>(detection.box.height / scale)};
+    }
+    return detections;
+}
+
+auto Detector::detectTiles(std::span<cv::Mat const> tiles) -> std::vector<std::vector<Detection>> {
+    auto padded = std::vector<cv::Mat>{};
+    padded.reserve(tiles.size());
+    for (auto const& tile : tiles) {
+        if (tile.cols > options_.inputSize.width || tile.rows > options_.inputSize.height) {
+            throw std::invalid_argument("Tile exceeds the detector input size");
+        }
+        padded.push_back(padToInput(tile, options_.inputSize));
+    }
+
+    auto results = std::vector<std::vector<Detection>>{};
+    results.reserve(tiles.size());
+    for (auto first = std::size_t{0}; first < padded.size(); first += options_.maxBatch) {
+        auto const count = std::min(padded.size() - first, static_cast<std::size_t>(options_.maxBatch));
+        std::ranges::move(forward(std::span{padded}.subspan(first, count)), std::back_inserter(results));
+    }
+    return results;
+}
+
+auto Detector::forward(std::span<cv::Mat const> inputs) -> std::vector<std::vector<Detection>> {
+    auto const blob = cv::dnn::blobFromImages(std::vector<cv::Mat>{inputs.begin(), inputs.end()}, 1.0 / 255.0, options_.inputSize, cv::Scalar{}, true, false);
+    net_.setInput(blob);
+    auto const output = net_.forward();
+
+    // YOLOv8 head layout is [batch, 4 + classes, anchors] with boxes as centre/size in input pixels.
+    auto const attributes = output.size[1];
+    auto const anchors = output.size[2];
+    auto const classes = attributes - 4;
+
+    auto results = std::vector<std::vector<Detection>>(inputs.size());
+    for (auto image = 0; image < static_cast<int>(inputs.size()); ++image) {
+        auto const* data = output.ptr<float>(image);
+        auto candidates = std::vector<Detection>{};
+        for (auto anchor = 0; anchor < anchors; ++anchor) {
+            auto bestClass = 0;
+            auto bestScore = data[4 * anchors + anchor];
+            for (auto classId = 1; classId < classes; ++classId) {
+                auto const score = data[(4 + classId) * anchors + anchor];
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestClass = classId;
+                }
+            }
+            if (bestScore < options_.confidenceThreshold) {
+                continue;
+            }
+
+            auto const cx = data[anchor];
+            auto const cy = data[anchors + anchor];
+            auto const w = data[2 * anchors + anchor];
+            auto const h = data[3 * anchors + anchor];
+            candidates.push_back({cv::Rect2f{cx - w / 2, cy - h / 2, w, h}, bestClass, bestScore});
+        }
+        results[image] = suppressOverlaps(std::move(candidates), options_.nmsThreshold);
+    }
+    return results;
+}
+
+auto intersectionOverUnion(cv::Rect2f const& lhs, cv::Rect2f const& rhs) -> float {
+    auto const intersection = (lhs & rhs).area();
+    auto const united = lhs.area() + rhs.area() - intersection;
+    return united > 0.0f ? intersection / united : 0.0f;
+}
+
+auto suppressOverlaps(std::vector<Detection> detections, float iouThreshold) -> std::vector<Detection> {
+    std::ranges::sort(detections, std::greater{}, &Detection::confidence);
+
+    auto kept = std::vector<Detection>{};
+    for (auto const& detection : detections) {
+        auto const overlaps = std::ranges::any_of(kept, [&](auto const& other) {
+            return other.classId == detection.classId && intersectionOverUnion(other.box, detection.box) > iouThreshold;
+        });
+        if (!overlaps) {
+            kept.push_back(detection);
+        }
+    }
+    return kept;
+}
+
+auto loadClassNames(std::filesystem::path const& path) -> std::vector<std::string> {
+    auto file = std::ifstream{path};
+    if (!file) {
+        throw std::runtime_error("Failed to open class names file " + path.string());
+    }
+
+    auto names = std::vector<std::string>{};
+    for (std::string line; std::getline(file, line);) {
+        if (!line.empty()) {
+            names.push_back(line);
+        }
+    }
+    return names;
+}
+
+} // namespace oraker
@@ -0,0 +1,154 @@
+#include <oraker/draw_analysis.hpp>
+
+#include <bit>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto LANE = CardMask{0x1FFF};
+
+// Per 13-bit rank set: the ranks that complete a straight, or a higher one than the set holds, and the
+// top rank plus one of the best straight two more ranks can reach (0 when none can).
+struct StraightTables {
+    std::array<std::uint16_t, 8192> completing{};
+    std::array<std::uint8_t, 8192> reachable{};
+};
+
+constexpr auto makeStraightTables() {
+    auto tables = StraightTables{};
+    for (auto ranks = 0u; ranks < 8192; ++ranks) {
+        for (auto rank = 0; rank < 13; ++rank) {
+            if (RANK_TABLES.straight[ranks | 1u << rank] > RANK_TABLES.straight[ranks]) {
+                tables.completing[ranks] |= static_cast<std::uint16_t>(1u << rank);
+            }
+        }
+        for (auto top = 12; top >= 3; --top) {
+            auto const straight = top == 3 ? 0x100Fu : 0x1Fu << (top - 4);
+            if (std::popcount(straight & ~ranks) <= 2) {
+                tables.reachable[ranks] = static_cast<std::uint8_t>(top + 1);
+                break;
+            }
+        }
+    }
+    return tables;
+}
+
+constexpr auto STRAIGHT_TABLES = makeStraightTables();
+
+auto lane(CardMask mask, int suit) { return static_cast<std::uint32_t>(mask >> (16 * suit) & LANE); }
+auto ranksOf(CardMask mask) { return lane(mask, 0) | lane(mask, 1) | lane(mask, 2) | lane(mask, 3); }
+
+// Hero and board masks of a flop or turn spot.
+auto spotMasks(std::span<Card const> hole, std::span<Card const> board) {
+    if (hole.size() != 2 || (board.size() != 3 && board.size() != 4)) {
+        throw std::runtime_error("Draw analysis needs two hole cards and a flop or turn");
+    }
+    auto const hero = handMask(hole);
+    auto const known = handMask(board);
+    if (std::popcount(hero | known) != static_cast<int>(hole.size() + board.size())) {
+        throw std::runtime_error("Draw analysis input holds the same card twice");
+    }
+    return std::pair{hero, known};
+}
+
+} // namespace
+
+auto analyzeDraws(std::span<Card const> hole, std::span<Card const> board) -> DrawAnalysis {
+    auto const [hero, known] = spotMasks(hole, board);
+    auto analysis = DrawAnalysis{};
+    analysis.made = evaluateHand(hero | known);
+
+    auto const category = handCategory(analysis.made);
+    for (auto index = 0; index < Card::COUNT; ++index) {
+        auto const card = Card::fromIndex(index).mask();
+        if (((hero | known) & card) != 0) {
+            continue;
+        }
+        auto const next = handCategory(evaluateHand(hero | known | card));
+        if (next > category && next > handCategory(evaluateHand(known | card))) {
+            analysis.outs |= card;
+            ++analysis.outsByCategory[static_cast<std::size_t>(next)];
+        }
+    }
+    analysis.outCount = std::popcount(analysis.outs);
+
+    for (auto suit = 0; suit < 4; ++suit) {
+        auto const held = std::popcount(lane(hero, suit));
+        auto const suited = held + std::popcount(lane(known, suit));
+        if (held == 0) {
+            continue;
+        }
+        if (suited == 4 && category < HandCategory::FLUSH) {
+            analysis.flushDraw = true;
+            auto const nut = RANK_TABLES.top[~lane(known, suit) & LANE];
+            analysis.nutFlushDraw = analysis.nutFlushDraw || (lane(hero, suit) >> nut & 1) != 0;
+        }
+        analysis.backdoorFlushDraw = analysis.backdoorFlushDraw || (board.size() == 3 && suited == 3);
+    }
+
+    // Only ranks that give hero a higher straight than the board alone would make count as draws.
+    auto const ranks = ranksOf(hero | known);
+    auto const boardRanks = ranksOf(known);
+    if (category < HandCategory::STRAIGHT) {
+        auto completing = 0;
+        auto nut = true;
+        for (auto candidates = std::uint32_t{STRAIGHT_TABLES.completing[ranks]}; candidates != 0; candidates &= candidates - 1) {
+            auto const rank = std::countr_zero(candidates);
+            auto const straight = RANK_TABLES.straight[ranks | 1u << rank];
+            if (straight > RANK_TABLES.straight[boardRanks | 1u << rank]) {
+                ++completing;
+                nut = nut && straight == STRAIGHT_TABLES.reachable[boardRanks | 1u << rank];
+            }
+        }
+        analysis.straightDraw = completing >= 2 ? StraightDraw::OPEN_ENDED : completing == 1 ? StraightDraw::GUTSHOT : StraightDraw::NONE;
+        analysis.nutStraightDraw = completing > 0 && nut;
+    }
+    return analysis;
+}
+
+auto nextCardEquity(std::span<Card const> hole, std::span<Card const> board) -> std::array<float, Card::COUNT> {
+    auto const [hero, known] = spotMasks(hole, board);
+    auto deck = std::vector<CardMask>{};
+    for (auto index = 0; index < Card::COUNT; ++index) {
+        if (auto const mask = Card::fromIndex(index).mask(); ((hero | known) & mask) == 0) {
+            deck.push_back(mask);
+        }
+    }
+    // Every villain hand from the live cards; those holding the next card are evaluated but skipped, which
+    // keeps one batch for all next cards.
+    auto villains = std::vector<CardMask>{};
+    for (auto first = std::size_t{0}; first < deck.size(); ++first) {
+        for (auto second = first + 1; second < deck.size(); ++second) {
+            villains.push_back(deck[first] | deck[second]);
+        }
+    }
+
+    auto equities = std::array<float, Card::COUNT>{};
+    equities.fill(-1.0f);
+    auto values = std::vector<HandValue>(villains.size());
+    for (auto index = 0; index < Card::COUNT; ++index) {
+        auto const card = Card::fromIndex(index).mask();
+        if (((hero | known) & card) != 0) {
+            continue;
+        }
+        auto const next = known | card;
+        auto const heroValue = evaluateHand(hero | next);
+        evaluateHands(villains, next, values);
+        auto share = 0.0;
+        auto hands = 0;
+        for (auto i = std::size_t{0}; i < villains.size(); ++i) {
+            if ((villains[i] & card) == 0) {
+                share += heroValue > values[i] ? 1.0 : heroValue == values[i] ? 0.5 : 0.0;
+                ++hands;
+            }
+        }
+        equities[static_cast<std::size_t>(index)] = static_cast<float>(share / hands);
+    }
+    return equities;
+}
+
+} // namespace oraker
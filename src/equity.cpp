@@ -0,0 +1,197 @@
+#include <oraker/equity.hpp>
+
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/omaha_evaluator.hpp>
+#include <oraker/xoshiro.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace oraker {
+
+namespace {
+
+// Pot share of one hand in units that split evenly between up to ten tied players.
+constexpr auto SHARE_UNIT = std::uint64_t{2520};
+// Batches between checks of the stopping rule; fixed so results do not depend on the thread count.
+constexpr auto ROUND_BATCHES = std::uint64_t{16};
+constexpr auto MAX_OPPONENTS = 9;
+
+struct Deal {
+    CardMask hero = 0;
+    CardMask board = 0;
+    int missingBoard = 0;
+    int opponents = 0;
+    // Two for Hold'em, four or five for Omaha.
+    int holeCards = 2;
+};
+
+// Padded to a cache line so threads never write to the same line.
+struct alignas(64) Tally {
+    std::uint64_t hands = 0;
+    std::uint64_t wins = 0;
+    std::uint64_t ties = 0;
+    std::uint64_t share = 0;
+    std::uint64_t shareSquares = 0;
+
+    auto operator+=(Tally const& other) -> Tally& {
+        hands += other.hands;
+        wins += other.wins;
+        ties += other.ties;
+        share += other.share;
+        shareSquares += other.shareSquares;
+        return *this;
+    }
+};
+
+// Partially shuffles just the cards one hand needs to the front of the deck. Any permutation of the
+// deck is a valid starting point, so the deck is only reset per batch to keep batches reproducible.
+auto simulate(Deal const& deal, std::span<CardMask> deck, Xoshiro256& random, Tally& tally) {
+    auto const needed = static_cast<std::size_t>(deal.missingBoard + deal.holeCards * deal.opponents);
+    for (auto i = std::size_t{0}; i < needed; ++i) {
+        std::swap(deck[i], deck[i + random.below(static_cast<std::uint32_t>(deck.size() - i))]);
+    }
+    auto board = deal.board;
+    for (auto i = 0; i < deal.missingBoard; ++i) {
+        board |= deck[static_cast<std::size_t>(i)];
+    }
+
+    auto const evaluate = [&](CardMask hand) { return deal.holeCards == 2 ? evaluateHand(hand | board) : evaluateOmaha(hand, board); };
+    auto const hero = evaluate(deal.hero);
+    auto best = HandValue{0};
+    auto tied = std::uint64_t{0};
+    auto const holeCards = static_cast<std::size_t>(deal.holeCards);
+    for (auto seat = std::size_t{0}, next = static_cast<std::size_t>(deal.missingBoard); seat < static_cast<std::size_t>(deal.opponents); ++seat, next += holeCards) {
+        auto hand = CardMask{0};
+        for (auto card = next; card < next + holeCards; ++card) {
+            hand |= deck[card];
+        }
+        auto const value = evaluate(hand);
+        if (value > best) {
+            best = value;
+            tied = 1;
+        } else if (value == best) {
+            ++tied;
+        }
+    }
+
+    ++tally.hands;
+    auto share = std::uint64_t{0};
+    if (hero > best) {
+        ++tally.wins;
+        share = SHARE_UNIT;
+    } else if (hero == best) {
+        ++tally.ties;
+        share = SHARE_UNIT / (tied + 1);
+    }
+    tally.share += share;
+    tally.shareSquares += share * share;
+}
+
+} // namespace
+
+MonteCarloEquity::MonteCarloEquity(Options options)
+    : options_{options} {
+    if (options_.batchHands < 1 || options_.maxHands < 1 || options_.z <= 0.0) {
+        throw std::runtime_error("Monte Carlo equity needs positive batch size, hand limit and interval quantile");
+    }
+}
+
+auto MonteCarloEquity::estimate(std::span<Card const> hole, std::span<Card const> board, int opponents) const -> Equity {
+    if ((hole.size() != 2 && hole.size() != 4 && hole.size() != 5) || board.size() > 5) {
+        throw std::runtime_error("Equity needs two, four or five hole cards and at most five board cards");
+    }
+    if (opponents < 1 || opponents > MAX_OPPONENTS) {
+        throw std::runtime_error("Equity needs one to nine opponents");
+    }
+    auto const deal = Deal{handMask(hole), handMask(board), static_cast<int>(5 - board.size()), opponents, static_cast<int>(hole.size())};
+    auto const dead = deal.hero | deal.board;
+    if (std::popcount(dead) != static_cast<int>(hole.size() + board.size())) {
+        throw std::runtime_error("Equity input holds the same card twice");
+    }
+    auto deck = std::vector<CardMask>{};
+    for (auto index = 0; index < Card::COUNT; ++index) {
+        if (auto const mask = Card::fromIndex(index).mask(); (dead & mask) == 0) {
+            deck.push_back(mask);
+        }
+    }
+    if (static_cast<std::size_t>(deal.missingBoard + deal.holeCards * opponents) > deck.size()) {
+        throw std::runtime_error("Not enough cards left to deal every opponent");
+    }
+
+    auto const threads = options_.threads > 0 ? options_.threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    auto const batchHands = static_cast<std::uint64_t>(options_.batchHands);
+    auto const maxBatches = (options_.maxHands + batchHands - 1) / batchHands;
+    auto const started = std::chrono::steady_clock::now();
+
+    auto tallies = std::vector<Tally>(static_cast<std::size_t>(threads));
+    auto total = Tally{};
+    auto halfWidth = 0.0;
+    auto roundStart = std::uint64_t{0};
+    auto roundBatches = std::min(ROUND_BATCHES, maxBatches);
+    auto claimed = std::atomic<std::uint64_t>{0};
+    auto done = false;
+
+    // Runs on one thread while the others wait at the barrier, so it may read every tally.
+    auto const endRound = [&]() noexcept {
+        total = {};
+        for (auto const& tally : tallies) {
+            total += tally;
+        }
+        auto const hands = static_cast<double>(total.hands);
+        auto const mean = static_cast<double>(total.share) / (hands * SHARE_UNIT);
+        auto const variance = std::max(0.0, static_cast<double>(total.shareSquares) / (hands * SHARE_UNIT * SHARE_UNIT) - mean * mean);
+        halfWidth = options_.z * std::sqrt(variance / hands);
+
+        roundStart += roundBatches;
+        roundBatches = std::min(ROUND_BATCHES, maxBatches - roundStart);
+        claimed.store(0, std::memory_order_relaxed);
+        auto const precise = options_.confidenceWidth > 0.0 && total.hands >= options_.minHands && 2.0 * halfWidth <= options_.confidenceWidth;
+        auto const late = options_.budget.count() > 0 && std::chrono::steady_clock::now() - started >= options_.budget;
+        done = roundBatches == 0 || precise || late;
+    };
+    auto round = std::barrier{threads, endRound};
+
+    auto const work = [&](std::size_t thread) {
+        auto cards = deck;
+        auto& tally = tallies[thread];
+        while (!done) {
+            for (auto batch = claimed.fetch_add(1, std::memory_order_relaxed); batch < roundBatches; batch = claimed.fetch_add(1, std::memory_order_relaxed)) {
+                auto random = Xoshiro256{options_.seed, roundStart + batch};
+                std::ranges::copy(deck, cards.begin());
+                for (auto hand = std::uint64_t{0}; hand < batchHands; ++hand) {
+                    simulate(deal, cards, random, tally);
+                }
+            }
+            round.arrive_and_wait();
+        }
+    };
+    auto workers = std::vector<std::thread>{};
+    for (auto thread = 1; thread < threads; ++thread) {
+        workers.emplace_back(work, static_cast<std::size_t>(thread));
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    auto const hands = static_cast<double>(total.hands);
+    return Equity{
+        .equity = static_cast<double>(total.share) / (hands * SHARE_UNIT),
+        .win = static_cast<double>(total.wins) / hands,
+        .tie = static_cast<double>(total.ties) / hands,
+        .halfWidth = halfWidth,
+        .hands = total.hands,
+        .seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count(),
+        .threads = threads,
+    };
+}
+
+} // namespace oraker
@@ -0,0 +1,95 @@
+#include <oraker/equity_cache.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <stdexcept>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto LANE = CardMask{0x1FFF};
+
+} // namespace
+
+auto SituationKeyHash::operator()(SituationKey const& key) const -> std::size_t {
+    // Multiply-xorshift mixing; the shard comes from the high bits, the LruCache bucket from the low ones.
+    auto hash = key.hole * 0x9E3779B97F4A7C15 ^ key.board;
+    hash = (hash ^ hash >> 29) * 0xBF58476D1CE4E5B9 ^ static_cast<std::uint64_t>(key.opponents);
+    return static_cast<std::size_t>(hash ^ hash >> 32);
+}
+
+auto canonicalSituation(std::span<Card const> hole, std::span<Card const> board, int opponents) -> SituationKey {
+    auto const holeMask = handMask(hole);
+    auto const boardMask = handMask(board);
+    auto lanes = std::array<std::uint32_t, 4>{};
+    for (auto suit = 0; suit < 4; ++suit) {
+        auto const shift = 16 * suit;
+        lanes[static_cast<std::size_t>(suit)] = static_cast<std::uint32_t>((boardMask >> shift & LANE) << 13 | (holeMask >> shift & LANE));
+    }
+    std::ranges::sort(lanes, std::greater{});
+    auto key = SituationKey{};
+    key.opponents = opponents;
+    for (auto suit = 0; suit < 4; ++suit) {
+        auto const lane = CardMask{lanes[static_cast<std::size_t>(suit)]};
+        key.hole |= (lane & LANE) << (16 * suit);
+        key.board |= (lane >> 13) << (16 * suit);
+    }
+    return key;
+}
+
+EquityCache::EquityCache(Options options) {
+    if (options.shards < 1 || options.capacity < static_cast<std::size_t>(options.shards)) {
+        throw std::runtime_error("Equity cache needs at least one shard and one entry per shard");
+    }
+    auto const shardCapacity = (options.capacity + static_cast<std::size_t>(options.shards) - 1) / static_cast<std::size_t>(options.shards);
+    for (auto i = 0; i < options.shards; ++i) {
+        shards_.push_back(std::make_unique<Shard>(shardCapacity));
+    }
+}
+
+auto EquityCache::shardOf(SituationKey const& key) const -> Shard& {
+    return *shards_[(SituationKeyHash{}(key) >> 48) % shards_.size()];
+}
+
+auto EquityCache::find(SituationKey const& key, double maxHalfWidth) -> std::optional<Equity> {
+    auto& shard = shardOf(key);
+    auto const lock = std::scoped_lock{shard.mutex};
+    auto const cached = shard.cache.find(key);
+    if (cached == nullptr) {
+        return std::nullopt;
+    }
+    if (cached->halfWidth > maxHalfWidth) {
+        ++shard.imprecise;
+        return std::nullopt;
+    }
+    return *cached;
+}
+
+auto EquityCache::insert(SituationKey const& key, Equity const& equity) -> void {
+    auto& shard = shardOf(key);
+    auto const lock = std::scoped_lock{shard.mutex};
+    // A concurrent looser computation finishing last must not replace a tighter interval.
+    if (auto const cached = shard.cache.peek(key); cached != nullptr && cached->halfWidth <= equity.halfWidth) {
+        return;
+    }
+    shard.cache.insert(key, equity);
+}
+
+auto EquityCache::statistics() const -> Statistics {
+    auto total = Statistics{};
+    for (auto const& shard : shards_) {
+        auto const lock = std::scoped_lock{shard->mutex};
+        auto const& statistics = shard->cache.statistics();
+        total.hits += statistics.hits - shard->imprecise;
+        total.misses += statistics.misses;
+        total.imprecise += shard->imprecise;
+        total.evictions += statistics.evictions;
+        total.entries += shard->cache.size();
+        total.memoryBytes += shard->cache.memoryFootprint();
+    }
+    return total;
+}
+
+} // namespace oraker
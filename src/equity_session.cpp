@@ -0,0 +1,58 @@
+#include <oraker/equity_session.hpp>
+
+#include <oraker/hand_evaluator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace oraker {
+
+EquitySession::EquitySession(Range const& hero, Range const& villain, std::span<Card const> board, Options options)
+    : board_{board.begin(), board.end()}
+    , threads_{options.threads > 0 ? options.threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))} {
+    if (board.size() != 3 && board.size() != 4) {
+        throw std::runtime_error("Equity session opens on the flop or turn");
+    }
+    runouts_ = RangeEquity{options}.runouts(hero, villain, board);
+}
+
+auto EquitySession::deal(Card card) -> void {
+    if (board_.size() == 5) {
+        throw std::runtime_error("The river is already dealt");
+    }
+    if ((handMask(board_) & card.mask()) != 0) {
+        throw std::runtime_error("Card " + card.toString() + " is already on the board");
+    }
+    board_.push_back(card);
+    std::erase_if(runouts_, [mask = card.mask()](RangeEquity::Runout const& runout) { return (runout.cards & mask) == 0; });
+}
+
+auto EquitySession::equity() const -> RangeEquity::Result {
+    auto const started = std::chrono::steady_clock::now();
+    auto total = RangeEquity::Matchups{};
+    for (auto const& runout : runouts_) {
+        total += runout.matchups;
+    }
+    auto result = RangeEquity::Result{.boards = runouts_.size(), .exact = true, .threads = threads_};
+    if (total.all > 0.0) {
+        result.equity = total.equity();
+        result.win = total.win / total.all;
+        result.tie = total.tie / total.all;
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return result;
+}
+
+auto EquitySession::equityAfter(Card card) const -> double {
+    auto total = RangeEquity::Matchups{};
+    for (auto const& runout : runouts_) {
+        if ((runout.cards & card.mask()) != 0) {
+            total += runout.matchups;
+        }
+    }
+    return total.equity();
+}
+
+} // namespace oraker
@@ -0,0 +1,187 @@
+#include <oraker/exact_equity.hpp>
+
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/omaha_evaluator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto LANE = CardMask{0x1FFF};
+
+// Maps suit s to suit target[s] in every card of a mask.
+struct SuitPermutation {
+    std::array<int, 4> target{};
+
+    auto apply(CardMask mask) const {
+        auto result = CardMask{0};
+        for (auto suit = 0; suit < 4; ++suit) {
+            result |= (mask >> (16 * suit) & LANE) << (16 * target[static_cast<std::size_t>(suit)]);
+        }
+        return result;
+    }
+};
+
+// Every permutation except the identity that maps each of the given masks onto itself.
+auto symmetriesOf(std::span<CardMask const> masks) {
+    auto symmetries = std::vector<SuitPermutation>{};
+    auto permutation = SuitPermutation{{0, 1, 2, 3}};
+    while (std::ranges::next_permutation(permutation.target).found) {
+        if (std::ranges::all_of(masks, [&](CardMask mask) { return permutation.apply(mask) == mask; })) {
+            symmetries.push_back(permutation);
+        }
+    }
+    return symmetries;
+}
+
+// Size of the mask's class under the group when the mask is the smallest member of its class, 0 otherwise.
+auto classWeight(CardMask mask, std::span<SuitPermutation const> symmetries) -> std::uint64_t {
+    auto fixed = std::uint64_t{1};
+    for (auto const& symmetry : symmetries) {
+        auto const image = symmetry.apply(mask);
+        if (image < mask) {
+            return 0;
+        }
+        fixed += image == mask;
+    }
+    return (symmetries.size() + 1) / fixed;
+}
+
+auto forEachCombination(std::span<CardMask const> deck, int count, CardMask chosen, std::function<void(CardMask)> const& visit) -> void {
+    if (count == 0) {
+        visit(chosen);
+        return;
+    }
+    for (auto i = std::size_t{0}; i + static_cast<std::size_t>(count) <= deck.size(); ++i) {
+        forEachCombination(deck.subspan(i + 1), count - 1, chosen | deck[i], visit);
+    }
+}
+
+struct Runout {
+    CardMask cards = 0;
+    std::uint64_t weight = 0;
+};
+
+} // namespace
+
+ExactEquity::ExactEquity(Options options)
+    : options_{options} {
+}
+
+auto ExactEquity::evaluate(std::span<Card const> hole, std::span<Card const> board, std::span<Card const> villain) const -> Result {
+    if ((hole.size() != 2 && hole.size() != 4 && hole.size() != 5) || board.size() > 5 || (!villain.empty() && villain.size() != hole.size())) {
+        throw std::runtime_error("Exact equity needs two, four or five hole cards, at most five board cards and as many or no villain cards");
+    }
+    auto const hero = handMask(hole);
+    auto const known = handMask(board);
+    auto const villainHand = handMask(villain);
+    auto const dead = hero | known | villainHand;
+    if (std::popcount(dead) != static_cast<int>(hole.size() + board.size() + villain.size())) {
+        throw std::runtime_error("Exact equity input holds the same card twice");
+    }
+    auto deck = std::vector<CardMask>{};
+    for (auto index = 0; index < Card::COUNT; ++index) {
+        if (auto const mask = Card::fromIndex(index).mask(); (dead & mask) == 0) {
+            deck.push_back(mask);
+        }
+    }
+
+    auto const started = std::chrono::steady_clock::now();
+    auto const fixedMasks = std::array{hero, known, villainHand};
+    auto const symmetries = options_.isomorphism ? symmetriesOf(fixedMasks) : std::vector<SuitPermutation>{};
+    auto runouts = std::vector<Runout>{};
+    forEachCombination(deck, static_cast<int>(5 - board.size()), 0, [&](CardMask cards) {
+        if (auto const weight = classWeight(cards, symmetries); weight != 0) {
+            runouts.push_back({cards, weight});
+        }
+    });
+
+    // Villain hands are reduced again by the permutations that also keep the completed board.
+    auto const holeCards = static_cast<int>(hole.size());
+    auto const evaluateRunout = [&](Runout const& runout, Result& result) {
+        auto const fullBoard = known | runout.cards;
+        auto const evaluate = [&](CardMask hand) { return holeCards == 2 ? evaluateHand(hand | fullBoard) : evaluateOmaha(hand, fullBoard); };
+        auto const heroValue = evaluate(hero);
+        auto const tally = [&](CardMask hand, std::uint64_t weight) {
+            auto const villainValue = evaluate(hand);
+            (heroValue > villainValue ? result.wins : heroValue == villainValue ? result.ties : result.losses) += weight;
+            ++result.evaluated;
+        };
+        if (villainHand != 0) {
+            tally(villainHand, runout.weight);
+            return;
+        }
+        auto boardSymmetries = std::vector<SuitPermutation>{};
+        for (auto const& symmetry : symmetries) {
+            if (symmetry.apply(runout.cards) == runout.cards) {
+                boardSymmetries.push_back(symmetry);
+            }
+        }
+        if (holeCards != 2) {
+            auto live = std::vector<CardMask>{};
+            std::ranges::copy_if(deck, std::back_inserter(live), [&](CardMask card) { return (card & runout.cards) == 0; });
+            forEachCombination(live, holeCards, 0, [&](CardMask hand) {
+                if (auto const weight = classWeight(hand, boardSymmetries); weight != 0) {
+                    tally(hand, runout.weight * weight);
+                }
+            });
+            return;
+        }
+        for (auto first = std::size_t{0}; first < deck.size(); ++first) {
+            if ((deck[first] & runout.cards) != 0) {
+                continue;
+            }
+            for (auto second = first + 1; second < deck.size(); ++second) {
+                if ((deck[second] & runout.cards) != 0) {
+                    continue;
+                }
+                auto const hand = deck[first] | deck[second];
+                if (auto const weight = classWeight(hand, boardSymmetries); weight != 0) {
+                    tally(hand, runout.weight * weight);
+                }
+            }
+        }
+    };
+
+    auto const threads = options_.threads > 0 ? options_.threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    auto results = std::vector<Result>(static_cast<std::size_t>(threads));
+    auto next = std::atomic<std::size_t>{0};
+    auto const work = [&](std::size_t thread) {
+        auto result = Result{};
+        for (auto index = next.fetch_add(1, std::memory_order_relaxed); index < runouts.size(); index = next.fetch_add(1, std::memory_order_relaxed)) {
+            evaluateRunout(runouts[index], result);
+        }
+        results[thread] = result;
+    };
+    auto workers = std::vector<std::thread>{};
+    for (auto thread = 1; thread < threads; ++thread) {
+        workers.emplace_back(work, static_cast<std::size_t>(thread));
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    auto total = Result{.threads = threads};
+    for (auto const& result : results) {
+        total.wins += result.wins;
+        total.ties += result.ties;
+        total.losses += result.losses;
+        total.evaluated += result.evaluated;
+    }
+    total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return total;
+}
+
+} // namespace oraker
@@ -0,0 +1,163 @@
+#include <oraker/frame_conversion.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto unpremultiply(std::uint32_t component, std::uint32_t alpha) {
+    return alpha == 0 ? 0u : std::min(255u, (component * 255 + alpha / 2) / alpha);
+}
+
+// Writes one source row into the wanted planes, optionally adding every pixel to the running sums of its
+// reduced column. Channel offsets are constants, so the compiler unrolls and vectorises every instance.
+template<PixelLayout LAYOUT, bool BGR, bool LUMA, bool SUM>
+auto convertRow(std::uint8_t const* source, int columns, std::uint8_t* bgr, std::uint8_t* gray, std::uint32_t* sums, int shift) -> void {
+    for (auto x = 0; x < columns; ++x, source += LAYOUT.bytesPerPixel) {
+        auto blue = static_cast<std::uint32_t>(source[LAYOUT.blue]);
+        auto green = static_cast<std::uint32_t>(source[LAYOUT.green]);
+        auto red = static_cast<std::uint32_t>(source[LAYOUT.red]);
+        if constexpr (LAYOUT.premultiplied) {
+            if (auto const alpha = static_cast<std::uint32_t>(source[LAYOUT.alpha]); alpha != 255) {
+                blue = unpremultiply(blue, alpha);
+                green = unpremultiply(green, alpha);
+                red = unpremultiply(red, alpha);
+            }
+        }
+        if constexpr (BGR) {
+            bgr[3 * x] = static_cast<std::uint8_t>(blue);
+            bgr[3 * x + 1] = static_cast<std::uint8_t>(green);
+            bgr[3 * x + 2] = static_cast<std::uint8_t>(red);
+        }
+        if constexpr (LUMA) {
+            gray[x] = luma(blue, green, red);
+        }
+        if constexpr (SUM) {
+            auto const sum = sums + (x >> shift) * 3;
+            sum[0] += blue;
+            sum[1] += green;
+            sum[2] += red;
+        }
+    }
+}
+
+template<PixelLayout LAYOUT, std::size_t... PLANES>
+constexpr auto rowKernels(std::index_sequence<PLANES...>) {
+    return std::array<CaptureConverter::RowKernel, 8>{convertRow<LAYOUT, (PLANES & 1) != 0, (PLANES & 2) != 0, (PLANES & 4) != 0>...};
+}
+
+template<std::size_t... LAYOUTS>
+constexpr auto layoutKernels(std::index_sequence<LAYOUTS...>) {
+    return std::array{rowKernels<SUPPORTED_PIXEL_LAYOUTS[LAYOUTS]>(std::make_index_sequence<8>{})...};
+}
+
+constexpr auto KERNELS = layoutKernels(std::make_index_sequence<SUPPORTED_PIXEL_LAYOUTS.size()>{});
+
+auto kernelIndex(FrameFormats formats, bool sum) {
+    return (formats.bgr ? 1 : 0) | (formats.luma ? 2 : 0) | (sum ? 4 : 0);
+}
+
+auto prepare(cv::Mat& plane, bool wanted, cv::Size size, int type) {
+    if (wanted) {
+        plane.create(size, type);
+    } else {
+        plane.release();
+    }
+}
+
+} // namespace
+
+CaptureConverter::CaptureConverter(PixelLayout layout)
+    : layout_{layout} {
+    auto const it = std::ranges::find(SUPPORTED_PIXEL_LAYOUTS, layout);
+    if (it == SUPPORTED_PIXEL_LAYOUTS.end()) {
+        throw std::runtime_error("Unsupported capture pixel layout");
+    }
+    kernels_ = KERNELS[static_cast<std::size_t>(it - SUPPORTED_PIXEL_LAYOUTS.begin())];
+}
+
+auto CaptureConverter::convert(cv::Mat const& capture, ConversionRequest const& request, ConvertedFrame& frame) const -> void {
+    if (capture.depth() != CV_8U || capture.channels() != layout_.bytesPerPixel) {
+        throw std::runtime_error("Capture does not match the converter's pixel layout");
+    }
+    auto const scale = request.reducedScale;
+    if (scale < 1 || scale > 4 || !std::has_single_bit(static_cast<unsigned>(scale))) {
+        throw std::runtime_error("Reduced frame scale must be 1, 2 or 4");
+    }
+
+    // Without reduction the reduced planes are the native ones.
+    auto const reducing = scale > 1 && (request.reduced.bgr || request.reduced.luma);
+    auto const native = scale > 1 ? request.native : request.native | request.reduced;
+    auto const shift = reducing ? std::countr_zero(static_cast<unsigned>(scale)) : 0;
+    auto const reducedSize = cv::Size{capture.cols >> shift, capture.rows >> shift};
+
+    frame.size = capture.size();
+    prepare(frame.bgr, native.bgr, capture.size(), CV_8UC3);
+    prepare(frame.luma, native.luma, capture.size(), CV_8UC1);
+    prepare(frame.reducedBgr, reducing && request.reduced.bgr, reducedSize, CV_8UC3);
+    prepare(frame.reducedLuma, reducing && request.reduced.luma, reducedSize, CV_8UC1);
+
+    auto const pixelBytes = layout_.bytesPerPixel;
+    auto const covered = reducing ? reducedSize.width << shift : 0;
+    auto const summing = kernels_[kernelIndex(native, true)];
+    auto const plain = kernels_[kernelIndex(native, false)];
+    auto const rowsOf = [&](int y) {
+        auto const source = capture.ptr<std::uint8_t>(y);
+        auto const bgr = native.bgr ? frame.bgr.ptr<std::uint8_t>(y) : nullptr;
+        auto const gray = native.luma ? frame.luma.ptr<std::uint8_t>(y) : nullptr;
+        return std::tuple{source, bgr, gray};
+    };
+
+    // Every band of 2^shift source rows feeds one reduced row, so bands convert independently.
+    cv::parallel_for_(cv::Range{0, capture.rows >> shift}, [&](cv::Range const& bands) {
+        auto sums = std::vector<std::uint32_t>(reducing ? static_cast<std::size_t>(reducedSize.width) * 3 : 0);
+        for (auto band = bands.start; band < bands.end; ++band) {
+            std::ranges::fill(sums, 0u);
+            for (auto y = band << shift; y < (band + 1) << shift; ++y) {
+                auto const [source, bgr, gray] = rowsOf(y);
+                summing(source, covered, bgr, gray, sums.data(), shift);
+                plain(source + covered * pixelBytes, capture.cols - covered, bgr ? bgr + covered * 3 : nullptr, gray ? gray + covered : nullptr, nullptr, 0);
+            }
+            if (!reducing) {
+                continue;
+            }
+
+            auto const area = static_cast<std::uint32_t>(scale * scale);
+            auto const reducedBgr = frame.reducedBgr.empty() ? nullptr : frame.reducedBgr.ptr<std::uint8_t>(band);
+            auto const reducedLuma = frame.reducedLuma.empty() ? nullptr : frame.reducedLuma.ptr<std::uint8_t>(band);
+            for (auto x = 0; x < reducedSize.width; ++x) {
+                auto const blue = (sums[3 * x] + area / 2) / area;
+                auto const green = (sums[3 * x + 1] + area / 2) / area;
+                auto const red = (sums[3 * x + 2] + area / 2) / area;
+                if (reducedBgr) {
+                    reducedBgr[3 * x] = static_cast<std::uint8_t>(blue);
+                    reducedBgr[3 * x + 1] = static_cast<std::uint8_t>(green);
+                    reducedBgr[3 * x + 2] = static_cast<std::uint8_t>(red);
+                }
+                if (reducedLuma) {
+                    reducedLuma[x] = luma(blue, green, red);
+                }
+            }
+        }
+    });
+
+    // Rows below the last full band only need the native planes.
+    for (auto y = (capture.rows >> shift) << shift; y < capture.rows; ++y) {
+        auto const [source, bgr, gray] = rowsOf(y);
+        plain(source, capture.cols, bgr, gray, nullptr, 0);
+    }
+
+    if (!reducing) {
+        frame.reducedBgr = request.reduced.bgr ? frame.bgr : cv::Mat{};
+        frame.reducedLuma = request.reduced.luma ? frame.luma : cv::Mat{};
+    }
+}
+
+} // namespace oraker
@@ -0,0 +1,36 @@
+#include <oraker/hand_evaluator.hpp>
+
+#include <array>
+
+namespace oraker {
+
+auto categoryName(HandCategory category) -> std::string_view {
+    static constexpr auto NAMES = std::array<std::string_view, 9>{
+        "high card", "pair", "two pair", "trips", "straight", "flush", "full house", "quads", "straight flush"};
+    return NAMES[static_cast<std::size_t>(category)];
+}
+
+auto handMask(std::span<Card const> cards) -> CardMask {
+    auto mask = CardMask{0};
+    for (auto const card : cards) {
+        mask |= card.mask();
+    }
+    return mask;
+}
+
+auto parseCards(std::string_view text) -> std::optional<std::vector<Card>> {
+    if (text.size() % 2 != 0) {
+        return std::nullopt;
+    }
+    auto cards = std::vector<Card>{};
+    for (auto offset = std::size_t{0}; offset < text.size(); offset += 2) {
+        auto const card = Card::parse(text.substr(offset, 2));
+        if (!card) {
+            return std::nullopt;
+        }
+        cards.push_back(*card);
+    }
+    return cards;
+}
+
+} // namespace oraker
@@ -0,0 +1,257 @@
+#include <oraker/hand_evaluator.hpp>
+
+#include <algorithm>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ORAKER_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace oraker {
+
+namespace {
+
+#if ORAKER_X86_SIMD
+
+// Kernels follow evaluateHand() lane by lane without branches: one packed table gather per rank set,
+// top ranks from the float exponent of the rank set, every candidate value computed and the winner
+// picked by category. Variable shifts by out-of-range counts give 0, so bits of the top rank of an
+// empty set vanish. Each kernel carries its own target, the library is built for the baseline CPU.
+
+constexpr auto CATEGORY_SHIFT = 24;
+
+[[gnu::target("avx2"), gnu::always_inline]] inline auto top(__m256i ranks) {
+    auto const exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(ranks)), 23);
+    return _mm256_sub_epi32(exponent, _mm256_set1_epi32(127));
+}
+
+[[gnu::target("avx2"), gnu::always_inline]] inline auto bit(__m256i rank) {
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), rank);
+}
+
+[[gnu::target("avx2"), gnu::always_inline]] inline auto value(HandCategory category, __m256i ranks) {
+    return _mm256_or_si256(_mm256_set1_epi32(static_cast<int>(category) << CATEGORY_SHIFT), ranks);
+}
+
+// Lanes of chosen where mask is set, of current elsewhere.
+[[gnu::target("avx2"), gnu::always_inline]] inline auto select(__m256i current, __m256i chosen, __m256i mask) {
+    return _mm256_or_si256(_mm256_and_si256(mask, chosen), _mm256_andnot_si256(mask, current));
+}
+
+[[gnu::target("avx2"), gnu::always_inline]] inline auto nonZero(__m256i x) {
+    return _mm256_xor_si256(_mm256_cmpeq_epi32(x, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+}
+
+[[gnu::target("avx2")]] auto evaluateAvx2(CardMask const* hands, CardMask board, HandValue* values) -> void {
+    auto const packed = reinterpret_cast<int const*>(RANK_TABLES.packed.data());
+    auto const withBoard = _mm256_set1_epi64x(static_cast<long long>(board));
+    auto const first = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(hands)), withBoard);
+    auto const second = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(hands + 4)), withBoard);
+    // Clubs and diamonds sit in the low half of every 64-bit mask, hearts and spades in the high half.
+    auto const halves = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    auto const a = _mm256_permutevar8x32_epi32(first, halves);
+    auto const b = _mm256_permutevar8x32_epi32(second, halves);
+    auto const low = _mm256_permute2x128_si256(a, b, 0x20);
+    auto const high = _mm256_permute2x128_si256(a, b, 0x31);
+    auto const lane = _mm256_set1_epi32(0x1FFF);
+    auto const clubs = _mm256_and_si256(low, lane);
+    auto const diamonds = _mm256_and_si256(_mm256_srli_epi32(low, 16), lane);
+    auto const hearts = _mm256_and_si256(high, lane);
+    auto const spades = _mm256_and_si256(_mm256_srli_epi32(high, 16), lane);
+    auto const ranks = _mm256_or_si256(_mm256_or_si256(clubs, diamonds), _mm256_or_si256(hearts, spades));
+
+    auto const nibble = _mm256_set1_epi32(0xF);
+    auto const topFive = _mm256_set1_epi32(0xFFFFF);
+    auto const info = _mm256_i32gather_epi32(packed, ranks, 4);
+    auto cards = _mm256_setzero_si256();
+    auto flush = _mm256_setzero_si256();
+    for (auto const suit : {clubs, diamonds, hearts, spades}) {
+        auto const suitInfo = _mm256_i32gather_epi32(packed, suit, 4);
+        auto const count = _mm256_srli_epi32(suitInfo, 28);
+        cards = _mm256_add_epi32(cards, count);
+        flush = _mm256_or_si256(flush, _mm256_and_si256(suitInfo, _mm256_cmpgt_epi32(count, _mm256_set1_epi32(4))));
+    }
+    auto const duplicates = _mm256_sub_epi32(cards, _mm256_srli_epi32(info, 28));
+
+    auto const pairs = _mm256_xor_si256(ranks, _mm256_xor_si256(_mm256_xor_si256(clubs, diamonds), _mm256_xor_si256(hearts, spades)));
+    auto const trips = _mm256_and_si256(_mm256_or_si256(_mm256_and_si256(clubs, diamonds), _mm256_and_si256(hearts, spades)),
+        _mm256_or_si256(_mm256_and_si256(clubs, hearts), _mm256_and_si256(diamonds, spades)));
+    auto const quads = _mm256_and_si256(_mm256_and_si256(clubs, diamonds), _mm256_and_si256(hearts, spades));
+
+    auto const highPair = top(pairs);
+    auto const secondPair = top(_mm256_xor_si256(pairs, bit(highPair)));
+    auto const pairKickers = _mm256_xor_si256(ranks, pairs);
+    auto const pairKicker1 = top(pairKickers);
+    auto const pairKicker2 = top(_mm256_xor_si256(pairKickers, bit(pairKicker1)));
+    auto const pairKicker3 = top(_mm256_xor_si256(_mm256_xor_si256(pairKickers, bit(pairKicker1)), bit(pairKicker2)));
+    auto const pair = value(HandCategory::PAIR, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(highPair, 16), _mm256_slli_epi32(pairKicker1, 12)),
+        _mm256_or_si256(_mm256_slli_epi32(pairKicker2, 8), _mm256_slli_epi32(pairKicker3, 4))));
+    auto const twoPairKicker = top(_mm256_xor_si256(_mm256_xor_si256(ranks, bit(highPair)), bit(secondPair)));
+    auto const twoPair = value(HandCategory::TWO_PAIR, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(highPair, 16), _mm256_slli_epi32(secondPair, 12)),
+        _mm256_slli_epi32(twoPairKicker, 8)));
+    auto const tripsRank = top(trips);
+    auto const tripsKickers = _mm256_xor_si256(ranks, bit(tripsRank));
+    auto const tripsKicker1 = top(tripsKickers);
+    auto const tripsKicker2 = top(_mm256_xor_si256(tripsKickers, bit(tripsKicker1)));
+    auto const threeOfAKind = value(HandCategory::TRIPS, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(tripsRank, 16), _mm256_slli_epi32(tripsKicker1, 12)),
+        _mm256_slli_epi32(tripsKicker2, 8)));
+    auto const fullHousePair = top(_mm256_xor_si256(_mm256_or_si256(pairs, trips), bit(tripsRank)));
+    auto const fullHouse = value(HandCategory::FULL_HOUSE, _mm256_or_si256(_mm256_slli_epi32(tripsRank, 16), _mm256_slli_epi32(fullHousePair, 12)));
+    auto const quadsRank = top(quads);
+    auto const quadsKicker = top(_mm256_xor_si256(ranks, bit(quadsRank)));
+    auto const fourOfAKind = value(HandCategory::QUADS, _mm256_or_si256(_mm256_slli_epi32(quadsRank, 16), _mm256_slli_epi32(quadsKicker, 12)));
+    auto const straightTop = _mm256_and_si256(_mm256_srli_epi32(info, 24), nibble);
+    auto const straight = value(HandCategory::STRAIGHT, _mm256_slli_epi32(_mm256_sub_epi32(straightTop, _mm256_set1_epi32(1)), 16));
+    auto const straightFlushTop = _mm256_and_si256(_mm256_srli_epi32(flush, 24), nibble);
+    auto const straightFlush = value(HandCategory::STRAIGHT_FLUSH, _mm256_slli_epi32(_mm256_sub_epi32(straightFlushTop, _mm256_set1_epi32(1)), 16));
+
+    auto const one = _mm256_cmpeq_epi32(duplicates, _mm256_set1_epi32(1));
+    auto const two = _mm256_cmpeq_epi32(duplicates, _mm256_set1_epi32(2));
+    auto const more = _mm256_cmpgt_epi32(duplicates, _mm256_set1_epi32(2));
+    auto const hasPairs = nonZero(pairs);
+    auto result = value(HandCategory::HIGH_CARD, _mm256_and_si256(info, topFive));
+    result = select(result, pair, one);
+    result = select(result, twoPair, _mm256_and_si256(two, hasPairs));
+    result = select(result, threeOfAKind, _mm256_andnot_si256(hasPairs, two));
+    result = select(result, twoPair, more);
+    result = select(result, fullHouse, _mm256_and_si256(more, nonZero(trips)));
+    result = select(result, fourOfAKind, _mm256_and_si256(more, nonZero(quads)));
+    result = select(result, straight, nonZero(straightTop));
+    result = select(result, value(HandCategory::FLUSH, _mm256_and_si256(flush, topFive)), nonZero(flush));
+    result = select(result, straightFlush, nonZero(straightFlushTop));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), result);
+}
+
+[[gnu::target("avx512f"), gnu::always_inline]] inline auto top(__m512i ranks) {
+    auto const exponent = _mm512_srli_epi32(_mm512_castps_si512(_mm512_cvtepi32_ps(ranks)), 23);
+    return _mm512_sub_epi32(exponent, _mm512_set1_epi32(127));
+}
+
+[[gnu::target("avx512f"), gnu::always_inline]] inline auto bit(__m512i rank) {
+    return _mm512_sllv_epi32(_mm512_set1_epi32(1), rank);
+}
+
+[[gnu::target("avx512f"), gnu::always_inline]] inline auto value(HandCategory category, __m512i ranks) {
+    return _mm512_or_si512(_mm512_set1_epi32(static_cast<int>(category) << CATEGORY_SHIFT), ranks);
+}
+
+[[gnu::target("avx512f")]] auto evaluateAvx512(CardMask const* hands, CardMask board, HandValue* values) -> void {
+    auto const packed = reinterpret_cast<int const*>(RANK_TABLES.packed.data());
+    auto const withBoard = _mm512_set1_epi64(static_cast<long long>(board));
+    auto const first = _mm512_or_si512(_mm512_loadu_si512(hands), withBoard);
+    auto const second = _mm512_or_si512(_mm512_loadu_si512(hands + 8), withBoard);
+    auto const low = _mm512_permutex2var_epi32(first, _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30), second);
+    auto const high = _mm512_permutex2var_epi32(first, _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31), second);
+    auto const lane = _mm512_set1_epi32(0x1FFF);
+    auto const clubs = _mm512_and_si512(low, lane);
+    auto const diamonds = _mm512_and_si512(_mm512_srli_epi32(low, 16), lane);
+    auto const hearts = _mm512_and_si512(high, lane);
+    auto const spades = _mm512_and_si512(_mm512_srli_epi32(high, 16), lane);
+    auto const ranks = _mm512_or_si512(_mm512_or_si512(clubs, diamonds), _mm512_or_si512(hearts, spades));
+
+    auto const nibble = _mm512_set1_epi32(0xF);
+    auto const topFive = _mm512_set1_epi32(0xFFFFF);
+    auto const info = _mm512_i32gather_epi32(ranks, packed, 4);
+    auto cards = _mm512_setzero_si512();
+    auto flush = _mm512_setzero_si512();
+    for (auto const suit : {clubs, diamonds, hearts, spades}) {
+        auto const suitInfo = _mm512_i32gather_epi32(suit, packed, 4);
+        auto const count = _mm512_srli_epi32(suitInfo, 28);
+        cards = _mm512_add_epi32(cards, count);
+        flush = _mm512_mask_or_epi32(flush, _mm512_cmpgt_epi32_mask(count, _mm512_set1_epi32(4)), flush, suitInfo);
+    }
+    auto const duplicates = _mm512_sub_epi32(cards, _mm512_srli_epi32(info, 28));
+
+    auto const pairs = _mm512_xor_si512(ranks, _mm512_xor_si512(_mm512_xor_si512(clubs, diamonds), _mm512_xor_si512(hearts, spades)));
+    auto const trips = _mm512_and_si512(_mm512_or_si512(_mm512_and_si512(clubs, diamonds), _mm512_and_si512(hearts, spades)),
+        _mm512_or_si512(_mm512_and_si512(clubs, hearts), _mm512_and_si512(diamonds, spades)));
+    auto const quads = _mm512_and_si512(_mm512_and_si512(clubs, diamonds), _mm512_and_si512(hearts, spades));
+
+    auto const highPair = top(pairs);
+    auto const secondPair = top(_mm512_xor_si512(pairs, bit(highPair)));
+    auto const pairKickers = _mm512_xor_si512(ranks, pairs);
+    auto const pairKicker1 = top(pairKickers);
+    auto const pairKicker2 = top(_mm512_xor_si512(pairKickers, bit(pairKicker1)));
+    auto const pairKicker3 = top(_mm512_xor_si512(_mm512_xor_si512(pairKickers, bit(pairKicker1)), bit(pairKicker2)));
+    auto const pair = value(HandCategory::PAIR, _mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(highPair, 16), _mm512_slli_epi32(pairKicker1, 12)),
+        _mm512_or_si512(_mm512_slli_epi32(pairKicker2, 8), _mm512_slli_epi32(pairKicker3, 4))));
+    auto const twoPairKicker = top(_mm512_xor_si512(_mm512_xor_si512(ranks, bit(highPair)), bit(secondPair)));
+    auto const twoPair = value(HandCategory::TWO_PAIR, _mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(highPair, 16), _mm512_slli_epi32(secondPair, 12)),
+        _mm512_slli_epi32(twoPairKicker, 8)));
+    auto const tripsRank = top(trips);
+    auto const tripsKickers = _mm512_xor_si512(ranks, bit(tripsRank));
+    auto const tripsKicker1 = top(tripsKickers);
+    auto const tripsKicker2 = top(_mm512_xor_si512(tripsKickers, bit(tripsKicker1)));
+    auto const threeOfAKind = value(HandCategory::TRIPS, _mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(tripsRank, 16), _mm512_slli_epi32(tripsKicker1, 12)),
+        _mm512_slli_epi32(tripsKicker2, 8)));
+    auto const fullHousePair = top(_mm512_xor_si512(_mm512_or_si512(pairs, trips), bit(tripsRank)));
+    auto const fullHouse = value(HandCategory::FULL_HOUSE, _mm512_or_si512(_mm512_slli_epi32(tripsRank, 16), _mm512_slli_epi32(fullHousePair, 12)));
+    auto const quadsRank = top(quads);
+    auto const quadsKicker = top(_mm512_xor_si512(ranks, bit(quadsRank)));
+    auto const fourOfAKind = value(HandCategory::QUADS, _mm512_or_si512(_mm512_slli_epi32(quadsRank, 16), _mm512_slli_epi32(quadsKicker, 12)));
+    auto const straightTop = _mm512_and_si512(_mm512_srli_epi32(info, 24), nibble);
+    auto const straight = value(HandCategory::STRAIGHT, _mm512_slli_epi32(_mm512_sub_epi32(straightTop, _mm512_set1_epi32(1)), 16));
+    auto const straightFlushTop = _mm512_and_si512(_mm512_srli_epi32(flush, 24), nibble);
+    auto const straightFlush = value(HandCategory::STRAIGHT_FLUSH, _mm512_slli_epi32(_mm512_sub_epi32(straightFlushTop, _mm512_set1_epi32(1)), 16));
+
+    auto const one = _mm512_cmpeq_epi32_mask(duplicates, _mm512_set1_epi32(1));
+    auto const two = _mm512_cmpeq_epi32_mask(duplicates, _mm512_set1_epi32(2));
+    auto const more = _mm512_cmpgt_epi32_mask(duplicates, _mm512_set1_epi32(2));
+    auto const hasPairs = _mm512_test_epi32_mask(pairs, pairs);
+    auto result = value(HandCategory::HIGH_CARD, _mm512_and_si512(info, topFive));
+    result = _mm512_mask_blend_epi32(one, result, pair);
+    result = _mm512_mask_blend_epi32(two & hasPairs, result, twoPair);
+    result = _mm512_mask_blend_epi32(two & ~hasPairs, result, threeOfAKind);
+    result = _mm512_mask_blend_epi32(more, result, twoPair);
+    result = _mm512_mask_blend_epi32(more & _mm512_test_epi32_mask(trips, trips), result, fullHouse);
+    result = _mm512_mask_blend_epi32(more & _mm512_test_epi32_mask(quads, quads), result, fourOfAKind);
+    result = _mm512_mask_blend_epi32(_mm512_test_epi32_mask(straightTop, straightTop), result, straight);
+    result = _mm512_mask_blend_epi32(_mm512_test_epi32_mask(flush, flush), result, value(HandCategory::FLUSH, _mm512_and_si512(flush, topFive)));
+    result = _mm512_mask_blend_epi32(_mm512_test_epi32_mask(straightFlushTop, straightFlushTop), result, straightFlush);
+    _mm512_storeu_si512(values, result);
+}
+
+auto detectSimdLevel() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SCALAR;
+}
+
+#else
+
+auto detectSimdLevel() {
+    return SimdLevel::SCALAR;
+}
+
+#endif
+
+} // namespace
+
+auto simdLevel() -> SimdLevel {
+    static auto const level = detectSimdLevel();
+    return level;
+}
+
+auto evaluateHands(std::span<CardMask const> hands, CardMask board, std::span<HandValue> values, SimdLevel level) -> void {
+    level = std::min(level, simdLevel());
+    auto i = std::size_t{0};
+#if ORAKER_X86_SIMD
+    if (level == SimdLevel::AVX512) {
+        for (; i + 16 <= hands.size(); i += 16) {
+            evaluateAvx512(hands.data() + i, board, values.data() + i);
+        }
+    }
+    if (level >= SimdLevel::AVX2) {
+        for (; i + 8 <= hands.size(); i += 8) {
+            evaluateAvx2(hands.data() + i, board, values.data() + i);
+        }
+    }
+#endif
+    for (; i < hands.size(); ++i) {
+        values[i] = evaluateHand(hands[i] | board);
+    }
+}
+
+} // namespace oraker
@@ -0,0 +1,22 @@
+#include <oraker/luma.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace oraker {
+
+auto toLuma(cv::Mat const& image) -> cv::Mat {
+    cv::Mat luma;
+    switch (image.channels()) {
+    case 4:
+        cv::cvtColor(image, luma, cv::COLOR_BGRA2GRAY);
+        break;
+    case 3:
+        cv::cvtColor(image, luma, cv::COLOR_BGR2GRAY);
+        break;
+    default:
+        luma = image;
+    }
+    return luma;
+}
+
+} // namespace oraker
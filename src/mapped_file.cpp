@@ -0,0 +1,62 @@
+#include <oraker/mapped_file.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace oraker {
+
+MappedFile::MappedFile(std::filesystem::path const& path) {
+    auto const descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("Failed to open " + path.string() + ": " + std::strerror(errno));
+    }
+
+    struct stat status {};
+    if (::fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        throw std::runtime_error("Failed to stat " + path.string() + ": " + std::strerror(errno));
+    }
+
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ > 0) {
+        auto* const mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(descriptor);
+            throw std::runtime_error("Failed to map " + path.string() + ": " + std::strerror(errno));
+        }
+        data_ = static_cast<std::byte const*>(mapping);
+    }
+    // The mapping keeps the file referenced, the descriptor is no longer needed.
+    ::close(descriptor);
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_{std::exchange(other.data_, nullptr)}
+    , size_{std::exchange(other.size_, 0)} {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        }
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+} // namespace oraker
@@ -0,0 +1,100 @@
+#include <oraker/omaha_evaluator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto MAX_HOLE = std::size_t{5};
+constexpr auto BOARD = std::size_t{5};
+
+// Single-card masks of the set bits, lowest first.
+template<std::size_t N>
+auto splitCards(CardMask mask, std::array<CardMask, N>& cards) {
+    auto count = std::size_t{0};
+    for (; mask != 0 && count < N; mask &= mask - 1) {
+        cards[count++] = mask & -mask;
+    }
+    return count;
+}
+
+auto pairsOf(CardMask hole, std::array<CardMask, 10>& pairs) {
+    auto cards = std::array<CardMask, MAX_HOLE>{};
+    auto const count = splitCards(hole, cards);
+    auto pairCount = std::size_t{0};
+    for (auto first = std::size_t{0}; first < count; ++first) {
+        for (auto second = first + 1; second < count; ++second) {
+            pairs[pairCount++] = cards[first] | cards[second];
+        }
+    }
+    return pairCount;
+}
+
+auto triplesOf(CardMask board, std::array<CardMask, 10>& triples) {
+    auto cards = std::array<CardMask, BOARD>{};
+    splitCards(board, cards);
+    auto tripleCount = std::size_t{0};
+    for (auto first = std::size_t{0}; first < BOARD; ++first) {
+        for (auto second = first + 1; second < BOARD; ++second) {
+            for (auto third = second + 1; third < BOARD; ++third) {
+                triples[tripleCount++] = cards[first] | cards[second] | cards[third];
+            }
+        }
+    }
+    return tripleCount;
+}
+
+} // namespace
+
+auto evaluateOmaha(CardMask hole, CardMask board) -> HandValue {
+    auto pairs = std::array<CardMask, 10>{};
+    auto triples = std::array<CardMask, 10>{};
+    auto const pairCount = pairsOf(hole, pairs);
+    triplesOf(board, triples);
+
+    // Bounds sorted high to low by insertion, ten entries at most.
+    auto bounds = std::array<HandValue, 10>{};
+    for (auto i = std::size_t{0}; i < pairCount; ++i) {
+        auto const pair = pairs[i];
+        auto const bound = evaluateHand(pair | board);
+        auto j = i;
+        for (; j > 0 && bounds[j - 1] < bound; --j) {
+            bounds[j] = bounds[j - 1];
+            pairs[j] = pairs[j - 1];
+        }
+        bounds[j] = bound;
+        pairs[j] = pair;
+    }
+
+    auto best = HandValue{0};
+    for (auto i = std::size_t{0}; i < pairCount && bounds[i] > best; ++i) {
+        for (auto const triple : triples) {
+            auto const value = evaluateHand(pairs[i] | triple);
+            best = std::max(best, value);
+            if (value == bounds[i]) {
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+auto evaluateOmahaExhaustive(CardMask hole, CardMask board) -> HandValue {
+    auto pairs = std::array<CardMask, 10>{};
+    auto triples = std::array<CardMask, 10>{};
+    auto const pairCount = pairsOf(hole, pairs);
+    triplesOf(board, triples);
+    auto best = HandValue{0};
+    for (auto i = std::size_t{0}; i < pairCount; ++i) {
+        for (auto const triple : triples) {
+            best = std::max(best, evaluateHand(pairs[i] | triple));
+        }
+    }
+    return best;
+}
+
+} // namespace oraker
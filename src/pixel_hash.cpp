@@ -0,0 +1,51 @@
+#include <oraker/pixel_hash.hpp>
+
+#include <bit>
+#include <cstring>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto MULTIPLIER = std::uint64_t{0x9e3779b97f4a7c15};
+
+constexpr auto mix(std::uint64_t hash, std::uint64_t word) {
+    return std::rotl((hash ^ word) * MULTIPLIER, 31);
+}
+
+// MurmurHash3 finaliser, spreads the last words' bits over the whole hash.
+constexpr auto finalise(std::uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccd;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+} // namespace
+
+auto hashPixels(cv::Mat const& image) -> std::uint64_t {
+    auto hash = mix(mix(MULTIPLIER, static_cast<std::uint64_t>(image.rows) << 32 | static_cast<std::uint32_t>(image.cols)), image.type());
+    auto const rowBytes = image.cols * image.elemSize();
+    // Continuous images are hashed as one row so no step is spent on row boundaries.
+    auto const rows = image.isContinuous() ? 1 : image.rows;
+    auto const bytes = image.isContinuous() ? rowBytes * image.rows : rowBytes;
+    for (auto row = 0; row < rows; ++row) {
+        auto const data = image.ptr<std::uint8_t>(row);
+        auto offset = std::size_t{0};
+        for (; offset + sizeof(std::uint64_t) <= bytes; offset += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, data + offset, sizeof(word));
+            hash = mix(hash, word);
+        }
+        if (offset < bytes) {
+            auto word = std::uint64_t{0};
+            std::memcpy(&word, data + offset, bytes - offset);
+            hash = mix(hash, word ^ (bytes - offset) << 56);
+        }
+    }
+    return finalise(hash);
+}
+
+} // namespace oraker
@@ -0,0 +1,20 @@
+#include <oraker/player_registry.hpp>
+
+namespace oraker {
+
+auto PlayerRegistry::idOf(std::string_view name) -> int {
+    if (auto const it = ids_.find(name); it != ids_.end()) {
+        return it->second;
+    }
+    auto const id = static_cast<int>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(names_.back(), id);
+    return id;
+}
+
+auto PlayerRegistry::find(std::string_view name) const -> std::optional<int> {
+    auto const it = ids_.find(name);
+    return it == ids_.end() ? std::nullopt : std::optional{it->second};
+}
+
+} // namespace oraker
@@ -0,0 +1,162 @@
+#include <oraker/preflop_table.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto MAGIC = std::array<char, 8>{'O', 'R', 'A', 'K', 'P', 'R', 'E', 'F'};
+// Written in host byte order; a reader on a host with the other order sees this swapped.
+constexpr auto BYTE_ORDER_MARK = std::uint32_t{0x01020304};
+
+// Fixed-size header, followed by opponents x CLASSES floats for random opponents, per range a
+// zero-padded name plus CLASSES floats, and CLASSES x CLASSES matchup floats when matchups is 1.
+struct Header {
+    std::array<char, 8> magic{};
+    std::uint32_t byteOrder = 0;
+    std::uint32_t version = 0;
+    std::uint32_t classes = 0;
+    std::uint32_t opponents = 0;
+    std::uint32_t ranges = 0;
+    std::uint32_t matchups = 0;
+    std::uint64_t hands = 0;
+    std::uint64_t boards = 0;
+};
+
+constexpr auto NAME_BYTES = PreflopTable::MAX_RANGE_NAME + 1;
+constexpr auto TABLE_BYTES = PreflopTable::CLASSES * sizeof(float);
+constexpr auto RANGE_BYTES = NAME_BYTES + TABLE_BYTES;
+constexpr auto MATCHUP_BYTES = PreflopTable::CLASSES * TABLE_BYTES;
+
+auto randomOffset(int handClass, int opponents) {
+    return sizeof(Header) + (static_cast<std::size_t>(opponents - 1) * PreflopTable::CLASSES + static_cast<std::size_t>(handClass)) * sizeof(float);
+}
+
+} // namespace
+
+PreflopTable::PreflopTable(std::filesystem::path const& path)
+    : file_{path} {
+    auto header = Header{};
+    if (file_.size() < sizeof(header)) {
+        throw std::runtime_error(path.string() + " is not a preflop equity table");
+    }
+    std::memcpy(&header, file_.data(), sizeof(header));
+    if (header.magic != MAGIC) {
+        throw std::runtime_error(path.string() + " is not a preflop equity table");
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        throw std::runtime_error(path.string() + " was written on a host with a different byte order");
+    }
+    if (header.version != VERSION || header.classes != CLASSES) {
+        throw std::runtime_error(path.string() + " has table version " + std::to_string(header.version) + ", expected " + std::to_string(VERSION));
+    }
+    if (header.opponents < 1 || header.opponents > MAX_OPPONENTS || header.matchups > 1
+        || file_.size() != sizeof(header) + header.opponents * TABLE_BYTES + header.ranges * RANGE_BYTES + header.matchups * MATCHUP_BYTES) {
+        throw std::runtime_error(path.string() + " is truncated or corrupt");
+    }
+    opponents_ = static_cast<int>(header.opponents);
+    ranges_ = static_cast<int>(header.ranges);
+    matchups_ = header.matchups == 1;
+    hands_ = header.hands;
+    boards_ = header.boards;
+}
+
+auto PreflopTable::write(std::filesystem::path const& path, Contents const& contents) -> void {
+    auto const opponents = contents.random.size() / CLASSES;
+    if (opponents < 1 || opponents > MAX_OPPONENTS || contents.random.size() != opponents * CLASSES) {
+        throw std::runtime_error("Preflop table needs 169 entries for each of one to nine opponent counts");
+    }
+    if (!contents.matchups.empty() && contents.matchups.size() != CLASSES * CLASSES) {
+        throw std::runtime_error("Preflop matchups need 169 x 169 entries");
+    }
+    auto header = Header{MAGIC, BYTE_ORDER_MARK, VERSION, CLASSES, static_cast<std::uint32_t>(opponents), static_cast<std::uint32_t>(contents.ranges.size()),
+        contents.matchups.empty() ? 0u : 1u, contents.hands, contents.boards};
+    auto file = std::ofstream{path, std::ios::binary};
+    if (!file) {
+        throw std::runtime_error("Failed to create " + path.string());
+    }
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    file.write(reinterpret_cast<char const*>(contents.random.data()), static_cast<std::streamsize>(contents.random.size() * sizeof(float)));
+    for (auto const& [name, equities] : contents.ranges) {
+        if (name.empty() || name.size() > MAX_RANGE_NAME || equities.size() != CLASSES) {
+            throw std::runtime_error("Invalid preflop range table \"" + name + "\"");
+        }
+        auto padded = std::array<char, NAME_BYTES>{};
+        std::ranges::copy(name, padded.begin());
+        file.write(padded.data(), padded.size());
+        file.write(reinterpret_cast<char const*>(equities.data()), TABLE_BYTES);
+    }
+    file.write(reinterpret_cast<char const*>(contents.matchups.data()), static_cast<std::streamsize>(contents.matchups.size() * sizeof(float)));
+    if (!file) {
+        throw std::runtime_error("Failed to write " + path.string());
+    }
+}
+
+auto PreflopTable::className(int handClass) -> std::string {
+    auto const row = handClass / 13;
+    auto const column = handClass % 13;
+    auto name = std::string{Card::RANKS[static_cast<std::size_t>(std::max(row, column))], Card::RANKS[static_cast<std::size_t>(std::min(row, column))]};
+    if (row != column) {
+        name += row > column ? 's' : 'o';
+    }
+    return name;
+}
+
+auto PreflopTable::representative(int handClass) -> std::pair<Card, Card> {
+    auto const row = handClass / 13;
+    auto const column = handClass % 13;
+    if (row == column) {
+        return {Card{row, 0}, Card{row, 1}};
+    }
+    return row > column ? std::pair{Card{row, 0}, Card{column, 0}} : std::pair{Card{column, 0}, Card{row, 1}};
+}
+
+auto PreflopTable::load(std::size_t offset) const -> float {
+    auto value = 0.0f;
+    std::memcpy(&value, file_.data() + offset, sizeof(value));
+    return value;
+}
+
+auto PreflopTable::equity(int handClass, int opponents) const -> float {
+    if (handClass < 0 || handClass >= CLASSES || opponents < 1 || opponents > opponents_) {
+        throw std::runtime_error("No preflop equity for class " + std::to_string(handClass) + " against " + std::to_string(opponents) + " opponents");
+    }
+    return load(randomOffset(handClass, opponents));
+}
+
+auto PreflopTable::rangeNames() const -> std::vector<std::string_view> {
+    auto names = std::vector<std::string_view>{};
+    for (auto range = 0; range < ranges_; ++range) {
+        auto const name = reinterpret_cast<char const*>(file_.data() + randomOffset(0, opponents_ + 1) + static_cast<std::size_t>(range) * RANGE_BYTES);
+        names.emplace_back(name, ::strnlen(name, NAME_BYTES));
+    }
+    return names;
+}
+
+auto PreflopTable::findRange(std::string_view name) const -> std::optional<int> {
+    auto const names = rangeNames();
+    auto const it = std::ranges::find(names, name);
+    return it == names.end() ? std::nullopt : std::optional{static_cast<int>(it - names.begin())};
+}
+
+auto PreflopTable::rangeEquity(int handClass, int range) const -> float {
+    if (handClass < 0 || handClass >= CLASSES || range < 0 || range >= ranges_) {
+        throw std::runtime_error("No preflop equity for class " + std::to_string(handClass) + " against range " + std::to_string(range));
+    }
+    return load(randomOffset(0, opponents_ + 1) + static_cast<std::size_t>(range) * RANGE_BYTES + NAME_BYTES + static_cast<std::size_t>(handClass) * sizeof(float));
+}
+
+auto PreflopTable::matchupEquity(int handClass, int villainClass) const -> float {
+    if (!matchups_ || handClass < 0 || handClass >= CLASSES || villainClass < 0 || villainClass >= CLASSES) {
+        throw std::runtime_error("No preflop matchup equity for class " + std::to_string(handClass) + " against class " + std::to_string(villainClass));
+    }
+    auto const matchup = static_cast<std::size_t>(handClass) * CLASSES + static_cast<std::size_t>(villainClass);
+    return load(randomOffset(0, opponents_ + 1) + static_cast<std::size_t>(ranges_) * RANGE_BYTES + matchup * sizeof(float));
+}
+
+} // namespace oraker
@@ -0,0 +1,374 @@
+#include <oraker/push_fold.hpp>
+
+#include <oraker/range.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+namespace oraker {
+
+namespace {
+
+constexpr auto CLASSES = static_cast<std::size_t>(PreflopTable::CLASSES);
+
+using Strategy = std::array<float, PreflopTable::CLASSES>;
+// Payoff of every player for one way the hand ends, in big blinds.
+using Payoffs = std::array<double, PushFoldSolver::MAX_PLAYERS>;
+
+auto classCombos(std::size_t handClass) {
+    auto const row = handClass / 13;
+    auto const column = handClass % 13;
+    return row == column ? 6.0 : row > column ? 4.0 : 12.0;
+}
+
+// Malmuth-Harville prize equity: a player takes each open place with the share of the remaining chips
+// they hold. Busted players split the places below the survivors.
+auto icm(std::span<double const> stacks, std::span<double const> payouts) {
+    auto const players = stacks.size();
+    auto equity = Payoffs{};
+    auto const alive = static_cast<std::size_t>(std::ranges::count_if(stacks, [](double stack) { return stack > 0.0; }));
+    auto chips = std::vector<double>(std::size_t{1} << players);
+    auto reach = std::vector<double>(chips.size());
+    reach[0] = 1.0;
+    auto const total = std::accumulate(stacks.begin(), stacks.end(), 0.0);
+    for (auto placed = std::size_t{0}; placed < chips.size(); ++placed) {
+        if (placed != 0) {
+            auto const lowest = static_cast<std::size_t>(std::countr_zero(placed));
+            chips[placed] = chips[placed & (placed - 1)] + stacks[lowest];
+        }
+        auto const place = static_cast<std::size_t>(std::popcount(placed));
+        if (reach[placed] == 0.0 || place >= std::min(alive, payouts.size())) {
+            continue;
+        }
+        auto const remaining = total - chips[placed];
+        for (auto player = std::size_t{0}; player < players; ++player) {
+            if ((placed >> player & 1) == 0 && stacks[player] > 0.0) {
+                auto const chance = reach[placed] * stacks[player] / remaining;
+                reach[placed | std::size_t{1} << player] += chance;
+                equity[player] += chance * payouts[place];
+            }
+        }
+    }
+    if (alive < players) {
+        auto const rest = alive < payouts.size() ? std::accumulate(payouts.begin() + static_cast<std::ptrdiff_t>(alive), payouts.end(), 0.0) : 0.0;
+        for (auto player = std::size_t{0}; player < players; ++player) {
+            if (stacks[player] <= 0.0) {
+                equity[player] = rest / static_cast<double>(players - alive);
+            }
+        }
+    }
+    return equity;
+}
+
+// Payoffs of every way a push/fold hand can end: folded around to the big blind, a pusher stealing the
+// blinds, or a pusher and one caller all-in with either winning.
+struct Outcomes {
+    int players = 0;
+    Payoffs foldAround{};
+    std::vector<Payoffs> steal;
+    // [pusher * players + caller]
+    std::vector<Payoffs> pusherWins;
+    std::vector<Payoffs> callerWins;
+};
+
+auto outcomes(PushFoldSolver::Spot const& spot) {
+    auto const players = spot.stacks.size();
+    auto posted = std::vector<double>(players, spot.ante);
+    posted[players - 2] += spot.smallBlind;
+    posted[players - 1] += 1.0;
+    auto const pot = std::accumulate(posted.begin(), posted.end(), 0.0);
+    auto const total = std::accumulate(spot.stacks.begin(), spot.stacks.end(), 0.0);
+    for (auto player = std::size_t{0}; player < players; ++player) {
+        if (spot.stacks[player] <= posted[player]) {
+            throw std::runtime_error("Every stack must cover its blind and ante");
+        }
+    }
+
+    auto const payoffs = [&](std::vector<double> const& stacks) {
+        if (spot.payouts.empty()) {
+            auto chips = Payoffs{};
+            std::ranges::copy(stacks, chips.begin());
+            return chips;
+        }
+        auto equity = icm(stacks, spot.payouts);
+        for (auto& value : equity) {
+            value *= total;
+        }
+        return equity;
+    };
+    auto const afterBlinds = [&] {
+        auto stacks = spot.stacks;
+        for (auto player = std::size_t{0}; player < players; ++player) {
+            stacks[player] -= posted[player];
+        }
+        return stacks;
+    };
+
+    auto result = Outcomes{};
+    result.players = static_cast<int>(players);
+    auto stacks = afterBlinds();
+    stacks[players - 1] += pot;
+    result.foldAround = payoffs(stacks);
+    result.steal.resize(players);
+    result.pusherWins.resize(players * players);
+    result.callerWins.resize(players * players);
+    for (auto pusher = std::size_t{0}; pusher + 1 < players; ++pusher) {
+        stacks = afterBlinds();
+        stacks[pusher] += pot;
+        result.steal[pusher] = payoffs(stacks);
+        for (auto caller = pusher + 1; caller < players; ++caller) {
+            auto const stake = std::min(spot.stacks[pusher], spot.stacks[caller]);
+            auto const dead = pot - posted[pusher] - posted[caller];
+            for (auto const& [winner, loser, slot] : {std::tuple{pusher, caller, &result.pusherWins}, std::tuple{caller, pusher, &result.callerWins}}) {
+                stacks = afterBlinds();
+                stacks[winner] = spot.stacks[winner] + stake + dead;
+                stacks[loser] = spot.stacks[loser] - stake;
+                (*slot)[pusher * players + caller] = payoffs(stacks);
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+auto PushFoldSolver::Solution::pushFrequency(int player) const -> double {
+    auto frequency = 0.0;
+    for (auto handClass = std::size_t{0}; handClass < CLASSES; ++handClass) {
+        frequency += classCombos(handClass) * push[static_cast<std::size_t>(player)][handClass];
+    }
+    return frequency / Range::COMBOS;
+}
+
+auto PushFoldSolver::Solution::callFrequency(int caller, int pusher) const -> double {
+    auto frequency = 0.0;
+    for (auto handClass = std::size_t{0}; handClass < CLASSES; ++handClass) {
+        frequency += classCombos(handClass) * callRange(caller, pusher)[handClass];
+    }
+    return frequency / Range::COMBOS;
+}
+
+PushFoldSolver::PushFoldSolver(PreflopTable const& table, Options options)
+    : options_{options}
+    , equity_(CLASSES * CLASSES)
+    , pairs_(CLASSES * CLASSES) {
+    if (!table.hasMatchups()) {
+        throw std::runtime_error("Push/fold solving needs a preflop table generated with class matchups");
+    }
+    if (options_.maxIterations < 1 || options_.tolerance <= 0.0) {
+        throw std::runtime_error("Push/fold solving needs a positive iteration limit and tolerance");
+    }
+    for (auto hero = 0; hero < PreflopTable::CLASSES; ++hero) {
+        for (auto villain = 0; villain < PreflopTable::CLASSES; ++villain) {
+            equity_[static_cast<std::size_t>(hero) * CLASSES + static_cast<std::size_t>(villain)] = table.matchupEquity(hero, villain);
+        }
+    }
+    auto classes = std::array<std::size_t, Range::COMBOS>{};
+    for (auto combo = 0; combo < Range::COMBOS; ++combo) {
+        auto const& [first, second] = Range::comboCards(combo);
+        classes[static_cast<std::size_t>(combo)] = static_cast<std::size_t>(PreflopTable::classIndex(first, second));
+    }
+    for (auto hero = 0; hero < Range::COMBOS; ++hero) {
+        for (auto villain = 0; villain < Range::COMBOS; ++villain) {
+            if ((Range::comboMask(hero) & Range::comboMask(villain)) == 0) {
+                pairs_[classes[static_cast<std::size_t>(hero)] * CLASSES + classes[static_cast<std::size_t>(villain)]] += 1.0f;
+            }
+        }
+    }
+}
+
+auto PushFoldSolver::solve(Spot const& spot) const -> Solution {
+    auto const players = spot.stacks.size();
+    if (players < 2 || players > MAX_PLAYERS) {
+        throw std::runtime_error("Push/fold solving needs two to ten players");
+    }
+    auto const started = std::chrono::steady_clock::now();
+    auto const ends = outcomes(spot);
+    auto const pusherWins = [&](std::size_t pusher, std::size_t caller) -> Payoffs const& { return ends.pusherWins[pusher * players + caller]; };
+    auto const callerWins = [&](std::size_t pusher, std::size_t caller) -> Payoffs const& { return ends.callerWins[pusher * players + caller]; };
+
+    auto prior = std::array<double, CLASSES>{};
+    auto pairTotals = std::array<double, CLASSES>{};
+    for (auto handClass = std::size_t{0}; handClass < CLASSES; ++handClass) {
+        prior[handClass] = classCombos(handClass) / Range::COMBOS;
+        for (auto other = std::size_t{0}; other < CLASSES; ++other) {
+            pairTotals[handClass] += pairs_[handClass * CLASSES + other];
+        }
+    }
+
+    // Everyone starts pushing and calling with every hand; averaged best responses move from there.
+    auto solution = Solution{};
+    solution.players = static_cast<int>(players);
+    solution.push.assign(players, {});
+    solution.call.assign(players * players, {});
+    for (auto pusher = std::size_t{0}; pusher + 1 < players; ++pusher) {
+        solution.push[pusher].fill(1.0f);
+        for (auto caller = pusher + 1; caller < players; ++caller) {
+            solution.call[caller * players + pusher].fill(1.0f);
+        }
+    }
+
+    // Per pusher and hand: each later player's chance to call and hero's equity when they do, the
+    // payoffs from each later player's turn on (onward[caller] is the turn after caller's), and the
+    // chance the action reaches each later player.
+    struct Continuation {
+        std::array<double, MAX_PLAYERS> callChance{};
+        std::array<double, MAX_PLAYERS> callEquity{};
+        Payoffs afterPusher{};
+        Payoffs onward{};
+        std::array<double, MAX_PLAYERS> reach{};
+    };
+    auto continuations = std::vector<Continuation>(players * CLASSES);
+    auto bestPush = solution.push;
+    auto bestCall = solution.call;
+
+    for (solution.iterations = 1; solution.iterations <= options_.maxIterations; ++solution.iterations) {
+        for (auto pusher = std::size_t{0}; pusher + 1 < players; ++pusher) {
+            for (auto hand = std::size_t{0}; hand < CLASSES; ++hand) {
+                auto& next = continuations[pusher * CLASSES + hand];
+                auto const* const pairs = &pairs_[hand * CLASSES];
+                auto const* const equities = &equity_[hand * CLASSES];
+                for (auto caller = pusher + 1; caller < players; ++caller) {
+                    auto const& calls = solution.call[caller * players + pusher];
+                    auto called = 0.0f;
+                    auto won = 0.0f;
+                    for (auto other = std::size_t{0}; other < CLASSES; ++other) {
+                        auto const weight = pairs[other] * calls[other];
+                        called += weight;
+                        won += weight * equities[other];
+                    }
+                    next.callChance[caller] = called / pairTotals[hand];
+                    next.callEquity[caller] = called > 0.0f ? won / called : 0.5;
+                }
+                auto onward = ends.steal[pusher];
+                for (auto caller = players - 1; caller > pusher; --caller) {
+                    next.onward[caller] = onward[caller];
+                    auto const chance = next.callChance[caller];
+                    auto const equity = next.callEquity[caller];
+                    for (auto player = std::size_t{0}; player < players; ++player) {
+                        onward[player] = chance * (equity * pusherWins(pusher, caller)[player] + (1.0 - equity) * callerWins(pusher, caller)[player])
+                            + (1.0 - chance) * onward[player];
+                    }
+                }
+                next.afterPusher = onward;
+                auto reach = 1.0;
+                for (auto caller = pusher + 1; caller < players; ++caller) {
+                    next.reach[caller] = reach;
+                    reach *= 1.0 - next.callChance[caller];
+                }
+            }
+        }
+
+        // Payoffs once the action reaches each player with everyone before folded, averaged over the
+        // hands that player pushes.
+        auto firstIn = std::vector<Payoffs>(players);
+        firstIn[players - 1] = ends.foldAround;
+        auto pushChance = std::vector<double>(players);
+        for (auto pusher = players - 1; pusher-- > 0;) {
+            auto pushed = Payoffs{};
+            for (auto hand = std::size_t{0}; hand < CLASSES; ++hand) {
+                auto const weight = prior[hand] * solution.push[pusher][hand];
+                pushChance[pusher] += weight;
+                for (auto player = std::size_t{0}; player < players; ++player) {
+                    pushed[player] += weight * continuations[pusher * CLASSES + hand].afterPusher[player];
+                }
+            }
+            for (auto player = std::size_t{0}; player < players; ++player) {
+                firstIn[pusher][player] = pushed[player] + (1.0 - pushChance[pusher]) * firstIn[pusher + 1][player];
+            }
+        }
+
+        // Best responses and what each player would gain by them, weighted by how often each decision comes up.
+        auto gains = std::array<double, MAX_PLAYERS>{};
+        auto reachFirst = 1.0;
+        for (auto pusher = std::size_t{0}; pusher + 1 < players; ++pusher) {
+            auto const fold = firstIn[pusher + 1][pusher];
+            for (auto hand = std::size_t{0}; hand < CLASSES; ++hand) {
+                auto const push = continuations[pusher * CLASSES + hand].afterPusher[pusher];
+                auto const current = solution.push[pusher][hand];
+                bestPush[pusher][hand] = push > fold ? 1.0f : 0.0f;
+                gains[pusher] += reachFirst * prior[hand] * (std::max(push, fold) - (current * push + (1.0 - current) * fold));
+            }
+
+            for (auto caller = pusher + 1; caller < players; ++caller) {
+                auto& best = bestCall[caller * players + pusher];
+                auto const& calls = solution.call[caller * players + pusher];
+                for (auto hand = std::size_t{0}; hand < CLASSES; ++hand) {
+                    // The pusher's hands given the caller's, each with the payoffs should the caller fold.
+                    auto const* const pairs = &pairs_[hand * CLASSES];
+                    auto pushed = 0.0;
+                    auto won = 0.0;
+                    auto folded = 0.0;
+                    for (auto other = std::size_t{0}; other < CLASSES; ++other) {
+                        auto const& next = continuations[pusher * CLASSES + other];
+                        auto const weight = static_cast<double>(pairs[other]) * solution.push[pusher][other] * next.reach[caller];
+                        pushed += weight;
+                        won += weight * equity_[hand * CLASSES + other];
+                        folded += weight * next.onward[caller];
+                    }
+                    if (pushed <= 0.0) {
+                        best[hand] = calls[hand];
+                        continue;
+                    }
+                    auto const equity = won / pushed;
+                    auto const call = equity * callerWins(pusher, caller)[caller] + (1.0 - equity) * pusherWins(pusher, caller)[caller];
+                    auto const fold = folded / pushed;
+                    best[hand] = call > fold ? 1.0f : 0.0f;
+                    auto const chance = reachFirst * prior[hand] * pushed / pairTotals[hand];
+                    gains[caller] += chance * (std::max(call, fold) - (calls[hand] * call + (1.0 - calls[hand]) * fold));
+                }
+            }
+            reachFirst *= 1.0 - pushChance[pusher];
+        }
+
+        solution.exploitability = *std::ranges::max_element(gains);
+        if (solution.exploitability <= options_.tolerance) {
+            solution.converged = true;
+            break;
+        }
+        // Averaging damps the flip-flopping of pure best responses; the step shrinks so the averages settle.
+        auto const step = static_cast<float>(1.0 / std::sqrt(static_cast<double>(solution.iterations) + 1.0));
+        for (auto index = std::size_t{0}; index < solution.push.size(); ++index) {
+            for (auto hand = std::size_t{0}; hand < CLASSES; ++hand) {
+                solution.push[index][hand] += step * (bestPush[index][hand] - solution.push[index][hand]);
+            }
+        }
+        for (auto index = std::size_t{0}; index < solution.call.size(); ++index) {
+            for (auto hand = std::size_t{0}; hand < CLASSES; ++hand) {
+                solution.call[index][hand] += step * (bestCall[index][hand] - solution.call[index][hand]);
+            }
+        }
+    }
+    solution.iterations = std::min(solution.iterations, options_.maxIterations);
+    solution.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return solution;
+}
+
+auto PushFoldSolver::solve(std::span<Spot const> spots) const -> std::vector<Solution> {
+    auto solutions = std::vector<Solution>(spots.size());
+    auto const threads = options_.threads > 0 ? options_.threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    auto next = std::atomic<std::size_t>{0};
+    auto const work = [&] {
+        for (auto index = next.fetch_add(1, std::memory_order_relaxed); index < spots.size(); index = next.fetch_add(1, std::memory_order_relaxed)) {
+            solutions[index] = solve(spots[index]);
+        }
+    };
+    auto workers = std::vector<std::thread>{};
+    for (auto thread = 1; thread < std::min(threads, static_cast<int>(spots.size())); ++thread) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return solutions;
+}
+
+} // namespace oraker
@@ -0,0 +1,140 @@
+#include <oraker/range.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace oraker {
+
+namespace {
+
+enum class Suitedness { ANY, SUITED, OFFSUIT };
+
+// Two ranks, high first, plus suitedness; pairs are always ANY.
+struct HandClass {
+    int high = 0;
+    int low = 0;
+    Suitedness suitedness = Suitedness::ANY;
+};
+
+auto trim(std::string_view text) {
+    auto const first = text.find_first_not_of(" \t\n");
+    if (first == std::string_view::npos) {
+        return std::string_view{};
+    }
+    return text.substr(first, text.find_last_not_of(" \t\n") - first + 1);
+}
+
+auto rankOf(char c) -> std::optional<int> {
+    auto const rank = Card::RANKS.find(c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c);
+    return rank == std::string_view::npos ? std::nullopt : std::optional{static_cast<int>(rank)};
+}
+
+auto parseClass(std::string_view text) -> std::optional<HandClass> {
+    if (text.size() < 2 || text.size() > 3) {
+        return std::nullopt;
+    }
+    auto const first = rankOf(text[0]);
+    auto const second = rankOf(text[1]);
+    if (!first || !second) {
+        return std::nullopt;
+    }
+    auto hand = HandClass{std::max(*first, *second), std::min(*first, *second), Suitedness::ANY};
+    if (text.size() == 3) {
+        if (hand.high == hand.low || (text[2] != 's' && text[2] != 'o')) {
+            return std::nullopt;
+        }
+        hand.suitedness = text[2] == 's' ? Suitedness::SUITED : Suitedness::OFFSUIT;
+    }
+    return hand;
+}
+
+auto addClass(Range& range, HandClass const& hand, float weight) {
+    for (auto first = 0; first < 4; ++first) {
+        for (auto second = 0; second < 4; ++second) {
+            auto const suited = first == second;
+            if (hand.high == hand.low ? second <= first
+                                      : (hand.suitedness == Suitedness::SUITED && !suited) || (hand.suitedness == Suitedness::OFFSUIT && suited)) {
+                continue;
+            }
+            range.setWeight(Range::comboIndex(Card{hand.high, first}, Card{hand.low, second}), weight);
+        }
+    }
+}
+
+auto addEntry(Range& range, std::string_view entry, float weight) {
+    if (entry.size() == 4) {
+        auto const first = Card::parse(entry.substr(0, 2));
+        auto const second = Card::parse(entry.substr(2));
+        if (first && second && *first != *second) {
+            range.setWeight(Range::comboIndex(*first, *second), weight);
+            return true;
+        }
+    }
+
+    // Ladders and spans walk the low rank, or both ranks for pairs.
+    auto const ladder = entry.ends_with('+');
+    auto const dash = entry.find('-');
+    auto const from = parseClass(entry.substr(0, ladder ? entry.size() - 1 : dash));
+    if (!from) {
+        return false;
+    }
+    auto to = *from;
+    if (ladder) {
+        to.low = from->high == from->low ? static_cast<int>(Card::RANKS.size()) - 1 : from->high - 1;
+    } else if (dash != std::string_view::npos) {
+        auto const end = parseClass(entry.substr(dash + 1));
+        if (!end || end->suitedness != from->suitedness || (end->high == end->low) != (from->high == from->low)
+            || (from->high != from->low && end->high != from->high)) {
+            return false;
+        }
+        to = *end;
+    }
+    auto const pair = from->high == from->low;
+    for (auto low = std::min(from->low, to.low); low <= std::max(from->low, to.low); ++low) {
+        addClass(range, {pair ? low : from->high, low, from->suitedness}, weight);
+    }
+    return true;
+}
+
+} // namespace
+
+auto Range::parse(std::string_view text) -> Range {
+    auto range = Range{};
+    while (!text.empty()) {
+        auto const comma = text.find(',');
+        auto entry = trim(text.substr(0, comma));
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+        if (entry.empty()) {
+            continue;
+        }
+
+        auto weight = 1.0f;
+        if (auto const colon = entry.find(':'); colon != std::string_view::npos) {
+            auto const number = trim(entry.substr(colon + 1));
+            auto const [end, error] = std::from_chars(number.data(), number.data() + number.size(), weight);
+            if (error != std::errc{} || end != number.data() + number.size() || weight < 0.0f) {
+                throw std::runtime_error("Invalid range weight \"" + std::string{number} + "\"");
+            }
+            entry = trim(entry.substr(0, colon));
+        }
+        if (!addEntry(range, entry, weight)) {
+            throw std::runtime_error("Invalid range entry \"" + std::string{entry} + "\"");
+        }
+    }
+    return range;
+}
+
+auto Range::full() -> Range {
+    auto range = Range{};
+    range.weights_.fill(1.0f);
+    return range;
+}
+
+auto Range::size() const -> int {
+    return static_cast<int>(std::ranges::count_if(weights_, [](float weight) { return weight > 0.0f; }));
+}
+
+} // namespace oraker
@@ -0,0 +1,315 @@
+#include <oraker/range_equity.hpp>
+
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/xoshiro.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace oraker {
+
+namespace {
+
+// Live combos of one range, structure of arrays so filtering and evaluation stream through memory.
+struct Combos {
+    std::vector<int> combos;
+    std::vector<CardMask> masks;
+    std::vector<float> weights;
+
+    auto clear() {
+        combos.clear();
+        masks.clear();
+        weights.clear();
+    }
+    auto add(int combo, CardMask mask, float weight) {
+        combos.push_back(combo);
+        masks.push_back(mask);
+        weights.push_back(weight);
+    }
+};
+
+using Matchups = RangeEquity::Matchups;
+
+// Per-thread buffers reused from board to board.
+struct Scratch {
+    Combos hero;
+    Combos villain;
+    std::vector<HandValue> heroValues;
+    std::vector<HandValue> villainValues;
+    std::vector<std::uint64_t> heroOrder;
+    std::vector<std::uint64_t> villainOrder;
+    std::vector<std::uint64_t> sortBuffer;
+};
+
+auto liveCombos(Range const& range, CardMask dead, Combos& live) {
+    live.clear();
+    for (auto combo = 0; combo < Range::COMBOS; ++combo) {
+        if (range.weight(combo) > 0.0f && (Range::comboMask(combo) & dead) == 0) {
+            live.add(combo, Range::comboMask(combo), range.weight(combo));
+        }
+    }
+}
+
+auto filter(Combos const& all, CardMask runout, Combos& live) {
+    live.clear();
+    for (auto i = std::size_t{0}; i < all.masks.size(); ++i) {
+        if ((all.masks[i] & runout) == 0) {
+            live.add(all.combos[i], all.masks[i], all.weights[i]);
+        }
+    }
+}
+
+// Positions of the values in ascending value order, packed as value << 32 | position. A byte-wise LSD
+// radix sort over the 28 value bits beats comparison sorting on wide ranges, narrow ones are cheaper
+// to sort directly.
+auto sortByValue(std::vector<HandValue> const& values, std::vector<std::uint64_t>& order, std::vector<std::uint64_t>& buffer) {
+    constexpr auto RADIX_MIN_SIZE = std::size_t{256};
+    order.resize(values.size());
+    for (auto i = std::size_t{0}; i < values.size(); ++i) {
+        order[i] = std::uint64_t{values[i]} << 32 | i;
+    }
+    if (order.size() < RADIX_MIN_SIZE) {
+        std::ranges::sort(order);
+        return;
+    }
+    buffer.resize(values.size());
+    for (auto shift = 32; shift < 60; shift += 8) {
+        auto counts = std::array<std::size_t, 257>{};
+        for (auto const entry : order) {
+            ++counts[(entry >> shift & 0xFF) + 1];
+        }
+        if (std::ranges::count(counts, order.size()) == 1) {
+            continue;
+        }
+        for (auto digit = std::size_t{1}; digit < counts.size(); ++digit) {
+            counts[digit] += counts[digit - 1];
+        }
+        for (auto const entry : order) {
+            buffer[counts[entry >> shift & 0xFF]++] = entry;
+        }
+        order.swap(buffer);
+    }
+}
+
+auto accumulateBoard(Combos const& heroAll, Combos const& villainAll, Range const& villainRange, CardMask board, CardMask runout, Scratch& scratch, Matchups& sums) {
+    auto& hero = scratch.hero;
+    auto& villain = scratch.villain;
+    filter(heroAll, runout, hero);
+    filter(villainAll, runout, villain);
+    scratch.heroValues.resize(hero.masks.size());
+    scratch.villainValues.resize(villain.masks.size());
+    evaluateHands(hero.masks, board | runout, scratch.heroValues);
+    evaluateHands(villain.masks, board | runout, scratch.villainValues);
+    sortByValue(scratch.heroValues, scratch.heroOrder, scratch.sortBuffer);
+    sortByValue(scratch.villainValues, scratch.villainOrder, scratch.sortBuffer);
+
+    // Villain weight in total, below the current hero value and up to it, overall and per card.
+    auto total = 0.0;
+    auto totalCard = std::array<double, Card::COUNT>{};
+    for (auto i = std::size_t{0}; i < villain.combos.size(); ++i) {
+        auto const& [first, second] = Range::comboCards(villain.combos[i]);
+        total += villain.weights[i];
+        totalCard[static_cast<std::size_t>(first.index())] += villain.weights[i];
+        totalCard[static_cast<std::size_t>(second.index())] += villain.weights[i];
+    }
+    auto below = 0.0;
+    auto belowCard = std::array<double, Card::COUNT>{};
+    auto upTo = 0.0;
+    auto upToCard = std::array<double, Card::COUNT>{};
+    auto const add = [&](std::uint64_t entry, double& sum, std::array<double, Card::COUNT>& cardSums) {
+        auto const position = static_cast<std::size_t>(entry & 0xFFFFFFFF);
+        auto const& [first, second] = Range::comboCards(villain.combos[position]);
+        auto const weight = villain.weights[position];
+        sum += weight;
+        cardSums[static_cast<std::size_t>(first.index())] += weight;
+        cardSums[static_cast<std::size_t>(second.index())] += weight;
+    };
+
+    auto const& villainOrder = scratch.villainOrder;
+    auto belowEnd = std::size_t{0};
+    auto upToEnd = std::size_t{0};
+    for (auto const entry : scratch.heroOrder) {
+        auto const value = entry >> 32;
+        for (; belowEnd < villainOrder.size() && villainOrder[belowEnd] >> 32 < value; ++belowEnd) {
+            add(villainOrder[belowEnd], below, belowCard);
+        }
+        for (; upToEnd < villainOrder.size() && villainOrder[upToEnd] >> 32 <= value; ++upToEnd) {
+            add(villainOrder[upToEnd], upTo, upToCard);
+        }
+
+        // Villain combos sharing a card with hero's are removed; the one sharing both is hero's own combo,
+        // counted once in each card's sum, so it is added back.
+        auto const position = static_cast<std::size_t>(entry & 0xFFFFFFFF);
+        auto const combo = hero.combos[position];
+        auto const& [first, second] = Range::comboCards(combo);
+        auto const a = static_cast<std::size_t>(first.index());
+        auto const b = static_cast<std::size_t>(second.index());
+        auto const same = static_cast<double>(villainRange.weight(combo));
+        auto const weight = static_cast<double>(hero.weights[position]);
+        auto const beaten = below - belowCard[a] - belowCard[b];
+        auto const notAbove = upTo - upToCard[a] - upToCard[b] + same;
+        sums.win += weight * beaten;
+        sums.tie += weight * (notAbove - beaten);
+        sums.all += weight * (total - totalCard[a] - totalCard[b] + same);
+    }
+}
+
+auto forEachRunout(std::span<CardMask const> deck, int count, CardMask chosen, std::vector<CardMask>& runouts) -> void {
+    if (count == 0) {
+        runouts.push_back(chosen);
+        return;
+    }
+    for (auto i = std::size_t{0}; i + static_cast<std::size_t>(count) <= deck.size(); ++i) {
+        forEachRunout(deck.subspan(i + 1), count - 1, chosen | deck[i], runouts);
+    }
+}
+
+// Board mask, live combos of both ranges and the cards left to deal.
+struct Spot {
+    CardMask known = 0;
+    Combos hero;
+    Combos villain;
+    std::vector<CardMask> deck;
+};
+
+auto prepare(Range const& hero, Range const& villain, std::span<Card const> board) {
+    auto spot = Spot{};
+    spot.known = handMask(board);
+    if (board.size() > 5 || std::popcount(spot.known) != static_cast<int>(board.size())) {
+        throw std::runtime_error("Range equity needs at most five distinct board cards");
+    }
+    liveCombos(hero, spot.known, spot.hero);
+    liveCombos(villain, spot.known, spot.villain);
+    if (spot.hero.combos.empty() || spot.villain.combos.empty()) {
+        throw std::runtime_error("Range has no combo left beside the board");
+    }
+    for (auto index = 0; index < Card::COUNT; ++index) {
+        if (auto const mask = Card::fromIndex(index).mask(); (spot.known & mask) == 0) {
+            spot.deck.push_back(mask);
+        }
+    }
+    return spot;
+}
+
+auto resolveThreads(int threads) { return threads > 0 ? threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency())); }
+
+// Hands batches out to the threads in order; work(batch, scratch) gets buffers private to its thread.
+template<typename Work>
+auto runBatches(int threads, std::size_t batches, Work const& work) {
+    auto next = std::atomic<std::size_t>{0};
+    auto const run = [&] {
+        auto scratch = Scratch{};
+        for (auto batch = next.fetch_add(1, std::memory_order_relaxed); batch < batches; batch = next.fetch_add(1, std::memory_order_relaxed)) {
+            work(batch, scratch);
+        }
+    };
+    auto workers = std::vector<std::thread>{};
+    for (auto thread = 1; thread < threads; ++thread) {
+        workers.emplace_back(run);
+    }
+    run();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace
+
+auto RangeEquity::Matchups::operator+=(Matchups const& other) -> Matchups& {
+    win += other.win;
+    tie += other.tie;
+    all += other.all;
+    return *this;
+}
+
+RangeEquity::RangeEquity(Options options)
+    : options_{options} {
+    if (options_.boards < 1 || options_.boardsPerBatch < 1) {
+        throw std::runtime_error("Range equity needs positive board and batch counts");
+    }
+}
+
+auto RangeEquity::evaluate(Range const& hero, Range const& villain, std::span<Card const> board) const -> Result {
+    auto const spot = prepare(hero, villain, board);
+    auto const started = std::chrono::steady_clock::now();
+    auto const missing = static_cast<int>(5 - board.size());
+    auto const exact = missing <= 2;
+    auto runouts = std::vector<CardMask>{};
+    if (exact) {
+        forEachRunout(spot.deck, missing, 0, runouts);
+    }
+    auto const boardsPerBatch = static_cast<std::size_t>(options_.boardsPerBatch);
+    auto const boards = exact ? runouts.size() : static_cast<std::size_t>(options_.boards);
+    auto const batches = (boards + boardsPerBatch - 1) / boardsPerBatch;
+
+    auto const threads = resolveThreads(options_.threads);
+    auto batchSums = std::vector<Matchups>(batches);
+    runBatches(threads, batches, [&](std::size_t batch, Scratch& scratch) {
+        auto sums = Matchups{};
+        auto random = Xoshiro256{options_.seed, batch};
+        auto cards = spot.deck;
+        auto const end = exact ? std::min(boards, (batch + 1) * boardsPerBatch) : (batch + 1) * boardsPerBatch;
+        for (auto index = batch * boardsPerBatch; index < end; ++index) {
+            auto runout = CardMask{0};
+            if (exact) {
+                runout = runouts[index];
+            } else {
+                for (auto i = std::size_t{0}; i < static_cast<std::size_t>(missing); ++i) {
+                    std::swap(cards[i], cards[i + random.below(static_cast<std::uint32_t>(cards.size() - i))]);
+                    runout |= cards[i];
+                }
+            }
+            accumulateBoard(spot.hero, spot.villain, villain, spot.known, runout, scratch, sums);
+        }
+        batchSums[batch] = sums;
+    });
+
+    auto total = Matchups{};
+    for (auto const& sums : batchSums) {
+        total += sums;
+    }
+    auto result = Result{.boards = exact ? boards : batches * boardsPerBatch, .exact = exact, .threads = threads};
+    if (total.all > 0.0) {
+        result.equity = total.equity();
+        result.win = total.win / total.all;
+        result.tie = total.tie / total.all;
+    }
+    // Batch equities scatter around the overall one; their spread bounds the sampling error.
+    if (!exact && batches > 1) {
+        auto squares = 0.0;
+        for (auto const& sums : batchSums) {
+            auto const deviation = sums.all > 0.0 ? sums.equity() - result.equity : 0.0;
+            squares += deviation * deviation;
+        }
+        result.halfWidth = 1.96 * std::sqrt(squares / static_cast<double>(batches - 1) / static_cast<double>(batches));
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return result;
+}
+
+auto RangeEquity::runouts(Range const& hero, Range const& villain, std::span<Card const> board) const -> std::vector<Runout> {
+    auto const spot = prepare(hero, villain, board);
+    if (board.size() < 3) {
+        throw std::runtime_error("Runout matchups need at least a flop");
+    }
+    auto masks = std::vector<CardMask>{};
+    forEachRunout(spot.deck, static_cast<int>(5 - board.size()), 0, masks);
+    auto runouts = std::vector<Runout>(masks.size());
+    auto const boardsPerBatch = static_cast<std::size_t>(options_.boardsPerBatch);
+    runBatches(resolveThreads(options_.threads), (masks.size() + boardsPerBatch - 1) / boardsPerBatch, [&](std::size_t batch, Scratch& scratch) {
+        for (auto index = batch * boardsPerBatch; index < std::min(masks.size(), (batch + 1) * boardsPerBatch); ++index) {
+            runouts[index].cards = masks[index];
+            accumulateBoard(spot.hero, spot.villain, villain, spot.known, masks[index], scratch, runouts[index].matchups);
+        }
+    });
+    return runouts;
+}
+
+} // namespace oraker
@@ -0,0 +1,41 @@
+#include <oraker/seat_names.hpp>
+
+namespace oraker {
+
+SeatNameReader::SeatNameReader(TextReader reader, PlayerRegistry& registry, std::size_t cacheEntries)
+    : reader_{std::move(reader)}
+    , registry_{registry}
+    , cache_{cacheEntries} {
+}
+
+auto SeatNameReader::update(cv::Mat const& luma, TableLayout const& layout) -> std::vector<int> const& {
+    if (players_.size() != layout.seats.size()) {
+        hashes_.assign(layout.seats.size(), 0);
+        players_.assign(layout.seats.size(), NO_PLAYER);
+    }
+
+    auto const bounds = cv::Rect{cv::Point{}, luma.size()};
+    for (auto seat = std::size_t{0}; seat < layout.seats.size(); ++seat) {
+        ++statistics_.checks;
+        auto const area = layout.seats[seat].name & bounds;
+        if (area.empty()) {
+            players_[seat] = NO_PLAYER;
+            continue;
+        }
+        auto const field = luma(area);
+        auto const hash = hashPixels(field);
+        if (hash == hashes_[seat]) {
+            continue;
+        }
+
+        hashes_[seat] = hash;
+        players_[seat] = cache_.getOrCompute(hash, [&] {
+            ++statistics_.reads;
+            auto const name = reader_.read(field);
+            return name.text.empty() || name.confidence < reader_.options().minScore ? NO_PLAYER : registry_.idOf(name.text);
+        });
+    }
+    return players_;
+}
+
+} // namespace oraker
@@ -0,0 +1,51 @@
+#include <oraker/seat_signals.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace oraker {
+
+namespace {
+
+auto toHsv(cv::Mat const& frame, cv::Rect const& rect) {
+    auto const area = rect & cv::Rect{cv::Point{}, frame.size()};
+    cv::Mat hsv;
+    if (!area.empty()) {
+        cv::cvtColor(frame(area), hsv, cv::COLOR_BGR2HSV);
+    }
+    return hsv;
+}
+
+auto coverage(cv::Mat const& hsv, ColourRange const& range) {
+    cv::Mat mask;
+    cv::inRange(hsv, range.lower, range.upper, mask);
+    return static_cast<double>(cv::countNonZero(mask)) / static_cast<double>(mask.total());
+}
+
+} // namespace
+
+SeatSignalReader::SeatSignalReader(Options options)
+    : options_{options} {
+}
+
+auto SeatSignalReader::read(cv::Mat const& frame, SeatLayout const& seat) const -> Signals {
+    auto signals = Signals{};
+    if (auto const plate = toHsv(frame, seat.anchor); !plate.empty()) {
+        signals.acting = coverage(plate, options_.timer) >= options_.timerCoverage;
+        signals.folded = !signals.acting && cv::mean(plate)[1] < options_.foldedSaturation;
+    }
+    if (auto const button = toHsv(frame, seat.dealerButton); !button.empty()) {
+        signals.dealer = coverage(button, options_.dealerButton) >= options_.dealerCoverage;
+    }
+    return signals;
+}
+
+auto SeatSignalReader::read(cv::Mat const& frame, TableLayout const& layout) const -> std::vector<Signals> {
+    auto signals = std::vector<Signals>{};
+    signals.reserve(layout.seats.size());
+    for (auto const& seat : layout.seats) {
+        signals.push_back(read(frame, seat));
+    }
+    return signals;
+}
+
+} // namespace oraker
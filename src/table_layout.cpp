@@ -0,0 +1,244 @@
+#include <oraker/table_layout.hpp>
+#include <oraker/card.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+
+namespace oraker {
+
+namespace {
+
+auto centre(cv::Rect const& rect) {
+    return cv::Point2f{rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f};
+}
+
+auto distance(cv::Point2f const& lhs, cv::Point2f const& rhs) {
+    return static_cast<float>(cv::norm(lhs - rhs));
+}
+
+auto contains(std::string_view name, std::string_view keyword) {
+    auto lower = std::string{name};
+    std::ranges::transform(lower, lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower.find(keyword) != std::string::npos;
+}
+
+} // namespace
+
+auto TableLayout::regions() const -> std::vector<TableRegion> {
+    auto regions = std::vector<TableRegion>{};
+    for (auto index = std::size_t{0}; index < seats.size(); ++index) {
+        auto const& seat = seats[index];
+        regions.push_back({"seat" + std::to_string(index), seat.anchor | seat.cards | seat.dealerButton});
+    }
+    if (!board.empty()) {
+        auto area = cv::Rect{};
+        for (auto const& slot : board) {
+            area |= slot;
+        }
+        regions.push_back({"board", area});
+    }
+    if (!pot.empty()) {
+        regions.push_back({"pot", pot});
+    }
+    return regions;
+}
+
+auto loadLayouts(std::filesystem::path const& path) -> std::vector<TableLayout> {
+    auto storage = cv::FileStorage{path.string(), cv::FileStorage::READ};
+    if (!storage.isOpened()) {
+        throw std::runtime_error("Failed to open layouts file " + path.string());
+    }
+
+    auto layouts = std::vector<TableLayout>{};
+    for (auto const& node : storage["layouts"]) {
+        auto& layout = layouts.emplace_back();
+        node["windowSize"] >> layout.windowSize;
+        node["board"] >> layout.board;
+        node["pot"] >> layout.pot;
+        for (auto const& seatNode : node["seats"]) {
+            auto& seat = layout.seats.emplace_back();
+            seatNode["anchor"] >> seat.anchor;
+            seatNode["name"] >> seat.name;
+            seatNode["stack"] >> seat.stack;
+            seatNode["cards"] >> seat.cards;
+            seatNode["dealerButton"] >> seat.dealerButton;
+        }
+    }
+    return layouts;
+}
+
+auto saveLayouts(std::filesystem::path const& path, std::span<TableLayout const> layouts) -> void {
+    auto storage = cv::FileStorage{path.string(), cv::FileStorage::WRITE};
+    if (!storage.isOpened()) {
+        throw std::runtime_error("Failed to create layouts file " + path.string());
+    }
+
+    storage << "layouts" << "[";
+    for (auto const& layout : layouts) {
+        storage << "{" << "windowSize" << layout.windowSize << "board" << layout.board << "pot" << layout.pot << "seats" << "[";
+        for (auto const& seat : layout.seats) {
+            storage << "{" << "anchor" << seat.anchor << "name" << seat.name << "stack" << seat.stack
+                    << "cards" << seat.cards << "dealerButton" << seat.dealerButton << "}";
+        }
+        storage << "]" << "}";
+    }
+    storage << "]";
+}
+
+auto findLayout(std::span<TableLayout const> layouts, cv::Size windowSize) -> std::optional<TableLayout> {
+    auto const it = std::ranges::find(layouts, windowSize, &TableLayout::windowSize);
+    return it == layouts.end() ? std::nullopt : std::optional{*it};
+}
+
+LayoutCalibrator::LayoutCalibrator(std::vector<std::string> classNames, Options options)
+    : classNames_{std::move(classNames)}
+    , options_{options} {
+}
+
+auto LayoutCalibrator::elementOf(int classId) const -> Element {
+    if (classId < 0 || classId >= static_cast<int>(classNames_.size())) {
+        return Element::NONE;
+    }
+    auto const& name = classNames_[classId];
+    if (Card::parse(name)) {
+        return Element::CARD;
+    }
+    if (contains(name, "seat")) {
+        return Element::SEAT;
+    }
+    if (contains(name, "pot")) {
+        return Element::POT;
+    }
+    if (contains(name, "dealer")) {
+        return Element::DEALER;
+    }
+    return Element::NONE;
+}
+
+auto LayoutCalibrator::accumulate(std::vector<Cluster>& clusters, cv::Rect2f const& box) const -> void {
+    auto const it = std::ranges::find_if(clusters, [&](Cluster const& cluster) {
+        return intersectionOverUnion(cv::Rect2f{cluster.box()}, box) >= options_.mergeIou;
+    });
+    if (it == clusters.end()) {
+        clusters.push_back({box, 1});
+        return;
+    }
+    it->sum = {it->sum.x + box.x, it->sum.y + box.y, it->sum.width + box.width, it->sum.height + box.height};
+    ++it->count;
+}
+
+auto LayoutCalibrator::observe(std::span<Detection const> detections, cv::Size frameSize) -> void {
+    if (frameSize != frameSize_) {
+        frameSize_ = frameSize;
+        frames_ = 0;
+        cards_.clear();
+        seats_.clear();
+        pots_.clear();
+        dealers_.clear();
+    }
+
+    for (auto const& detection : detections) {
+        switch (elementOf(detection.classId)) {
+        case Element::CARD:
+            accumulate(cards_, detection.box);
+            break;
+        case Element::SEAT:
+            accumulate(seats_, detection.box);
+            break;
+        case Element::POT:
+            accumulate(pots_, detection.box);
+            break;
+        case Element::DEALER:
+            accumulate(dealers_, detection.box);
+            break;
+        case Element::NONE:
+            break;
+        }
+    }
+    ++frames_;
+}
+
+auto LayoutCalibrator::layout() const -> std::optional<TableLayout> {
+    auto layout = TableLayout{};
+    layout.windowSize = frameSize_;
+    for (auto const& cluster : seats_) {
+        auto const anchor = cluster.box();
+        // Poker Now prints the player name above the stack on the seat plate.
+        auto const half = anchor.height / 2;
+        auto& seat = layout.seats.emplace_back();
+        seat.anchor = anchor;
+        seat.name = {anchor.x, anchor.y, anchor.width, half};
+        seat.stack = {anchor.x, anchor.y + half, anchor.width, anchor.height - half};
+    }
+
+    auto const nearestSeat = [&](cv::Point2f const& point) {
+        auto nearest = -1;
+        auto nearestDistance = distance(point, {frameSize_.width * 0.5f, frameSize_.height * 0.5f});
+        for (auto index = 0; index < static_cast<int>(layout.seats.size()); ++index) {
+            if (auto const d = distance(point, centre(layout.seats[index].anchor)); d < nearestDistance) {
+                nearest = index;
+                nearestDistance = d;
+            }
+        }
+        return nearest;
+    };
+
+    // Cards closer to the table centre than to any seat are community cards, the rest are hole cards.
+    auto board = std::vector<cv::Rect>{};
+    for (auto const& cluster : cards_) {
+        auto const box = cluster.box();
+        if (auto const seat = nearestSeat(centre(box)); seat >= 0) {
+            layout.seats[seat].cards |= box;
+        } else {
+            board.push_back(box);
+        }
+    }
+    for (auto const& cluster : dealers_) {
+        auto const box = cluster.box();
+        if (auto const seat = nearestSeat(centre(box)); seat >= 0) {
+            layout.seats[seat].dealerButton = box;
+        }
+    }
+    auto const pot = std::ranges::max_element(pots_, {}, &Cluster::count);
+    if (pot != pots_.end()) {
+        layout.pot = pot->box();
+    }
+
+    // Without seat classes hole cards land here too, keep the row holding the most cards.
+    auto const sameRow = [](cv::Rect const& lhs, cv::Rect const& rhs) { return std::abs(centre(lhs).y - centre(rhs).y) < lhs.height * 0.5f; };
+    auto const row = std::ranges::max_element(board, {}, [&](cv::Rect const& box) {
+        return std::ranges::count_if(board, [&](cv::Rect const& other) { return sameRow(box, other); });
+    });
+    if (row != board.end()) {
+        auto const rowBox = *row;
+        std::erase_if(board, [&](cv::Rect const& box) { return !sameRow(rowBox, box); });
+    }
+
+    // The flop is always dealt before the turn and river, so the leftmost card observed sits in the first slot
+    // and the remaining slots follow at the spacing of adjacent cards.
+    if (!board.empty()) {
+        std::ranges::sort(board, {}, [](cv::Rect const& rect) { return rect.x; });
+        auto size = cv::Size2f{};
+        for (auto const& box : board) {
+            size += cv::Size2f{box.size()} / static_cast<float>(board.size());
+        }
+        auto pitch = std::optional<float>{};
+        for (auto index = std::size_t{1}; index < board.size(); ++index) {
+            if (auto const gap = static_cast<float>(board[index].x - board[index - 1].x); gap > size.width * 0.5f) {
+                pitch = std::min(pitch.value_or(gap), gap);
+            }
+        }
+        for (auto slot = 0; slot < BOARD_SLOTS; ++slot) {
+            layout.board.push_back(cv::Rect{cv::Rect2f{board.front().x + slot * pitch.value_or(size.width * 1.1f), static_cast<float>(board.front().y), size.width, size.height}});
+        }
+    }
+
+    if (layout.seats.empty() && layout.board.empty()) {
+        return std::nullopt;
+    }
+    return layout;
+}
+
+} // namespace oraker
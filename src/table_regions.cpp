@@ -0,0 +1,68 @@
+#include <oraker/table_regions.hpp>
+
+#include <stdexcept>
+
+namespace oraker {
+
+auto loadRegions(std::filesystem::path const& path) -> std::vector<TableRegion> {
+    auto storage = cv::FileStorage{path.string(), cv::FileStorage::READ};
+    if (!storage.isOpened()) {
+        throw std::runtime_error("Failed to open regions file " + path.string());
+    }
+
+    auto regions = std::vector<TableRegion>{};
+    for (auto const& node : storage["regions"]) {
+        auto& region = regions.emplace_back();
+        node["name"] >> region.name;
+        node["rect"] >> region.rect;
+    }
+    return regions;
+}
+
+auto saveRegions(std::filesystem::path const& path, std::span<TableRegion const> regions) -> void {
+    auto storage = cv::FileStorage{path.string(), cv::FileStorage::WRITE};
+    if (!storage.isOpened()) {
+        throw std::runtime_error("Failed to create regions file " + path.string());
+    }
+
+    storage << "regions" << "[";
+    for (auto const& region : regions) {
+        storage << "{" << "name" << region.name << "rect" << region.rect << "}";
+    }
+    storage << "]";
+}
+
+RegionLearner::RegionLearner(int padding)
+    : padding_{padding} {
+}
+
+auto RegionLearner::observe(std::span<Detection const> detections, cv::Size frameSize) -> void {
+    auto const frame = cv::Rect{cv::Point{}, frameSize};
+    for (auto const& detection : detections) {
+        auto grown = (cv::Rect{detection.box} + cv::Size{2 * padding_, 2 * padding_} - cv::Point{padding_, padding_}) & frame;
+        if (grown.empty()) {
+            continue;
+        }
+
+        // Absorb every region the new box touches, repeating since the union may reach further ones.
+        for (auto merged = true; merged;) {
+            merged = false;
+            for (auto it = regions_.begin(); it != regions_.end(); ++it) {
+                if ((it->rect & grown).empty()) {
+                    continue;
+                }
+                grown |= it->rect;
+                regions_.erase(it);
+                merged = true;
+                break;
+            }
+        }
+        regions_.push_back({{}, grown});
+    }
+
+    for (auto index = std::size_t{0}; index < regions_.size(); ++index) {
+        regions_[index].name = "learned" + std::to_string(index);
+    }
+}
+
+} // namespace oraker
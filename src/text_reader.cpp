@@ -0,0 +1,133 @@
+#include <oraker/text_reader.hpp>
+#include <oraker/luma.hpp>
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace oraker {
+
+TextReader::TextReader(std::string alphabet, Options options)
+    : alphabet_{std::move(alphabet)}
+    , options_{options}
+    , glyphs_{options.glyphSize} {
+}
+
+auto TextReader::load(std::filesystem::path const& directory) -> TextReader {
+    auto storage = cv::FileStorage{(directory / "reader.yml").string(), cv::FileStorage::READ};
+    if (!storage.isOpened()) {
+        throw std::runtime_error("Failed to open glyph set in " + directory.string());
+    }
+    auto alphabet = std::string{};
+    auto options = Options{};
+    storage["alphabet"] >> alphabet;
+    storage["glyphSize"] >> options.glyphSize;
+    storage["minScore"] >> options.minScore;
+    storage["threshold"] >> options.threshold;
+
+    auto reader = TextReader{alphabet, options};
+    for (auto const character : alphabet) {
+        auto const glyph = cv::imread((directory / ("glyph_" + std::to_string(static_cast<int>(character)) + ".png")).string(), cv::IMREAD_GRAYSCALE);
+        if (!glyph.empty()) {
+            reader.glyphs_.addSample(character, glyph);
+        }
+    }
+    return reader;
+}
+
+auto TextReader::save(std::filesystem::path const& directory) const -> void {
+    std::filesystem::create_directories(directory);
+    auto storage = cv::FileStorage{(directory / "reader.yml").string(), cv::FileStorage::WRITE};
+    storage << "alphabet" << alphabet_ << "glyphSize" << options_.glyphSize << "minScore" << options_.minScore << "threshold" << options_.threshold;
+
+    for (auto const label : glyphs_.labels()) {
+        cv::imwrite((directory / ("glyph_" + std::to_string(label) + ".png")).string(), glyphs_.templateImage(label));
+    }
+}
+
+auto TextReader::segment(cv::Mat const& field) const -> std::vector<cv::Mat> {
+    cv::Mat binary;
+    auto const otsu = options_.threshold < 0;
+    cv::threshold(toLuma(field), binary, otsu ? 0 : options_.threshold, 255, cv::THRESH_BINARY | (otsu ? cv::THRESH_OTSU : 0));
+    // Text is the minority of pixels whatever its colour, make it the foreground.
+    if (cv::countNonZero(binary) * 2 > static_cast<int>(binary.total())) {
+        cv::bitwise_not(binary, binary);
+    }
+
+    cv::Mat columns;
+    cv::Mat rows;
+    cv::reduce(binary, columns, 0, cv::REDUCE_MAX);
+    cv::reduce(binary, rows, 1, cv::REDUCE_MAX);
+
+    auto top = 0;
+    auto bottom = rows.rows;
+    while (top < bottom && rows.at<std::uint8_t>(top) == 0) {
+        ++top;
+    }
+    while (bottom > top && rows.at<std::uint8_t>(bottom - 1) == 0) {
+        --bottom;
+    }
+    if (top == bottom) {
+        return {};
+    }
+
+    // Every glyph keeps the full text line height so points and commas stay distinguishable from digits,
+    // and is padded to the glyph aspect ratio so narrow glyphs are not stretched.
+    auto const lineHeight = bottom - top;
+    auto const boxWidth = cvRound(lineHeight * static_cast<double>(options_.glyphSize.width) / options_.glyphSize.height);
+    auto glyphs = std::vector<cv::Mat>{};
+    auto const ink = columns.ptr<std::uint8_t>();
+    for (auto x = 0; x < columns.cols;) {
+        if (ink[x] == 0) {
+            ++x;
+            continue;
+        }
+        auto const begin = x;
+        while (x < columns.cols && ink[x] != 0) {
+            ++x;
+        }
+
+        auto const glyph = binary(cv::Rect{begin, top, x - begin, lineHeight});
+        auto const padding = std::max(boxWidth - glyph.cols, 0);
+        cv::Mat padded;
+        cv::copyMakeBorder(glyph, padded, 0, 0, padding / 2, padding - padding / 2, cv::BORDER_CONSTANT, cv::Scalar{0});
+        glyphs.push_back(padded);
+    }
+    return glyphs;
+}
+
+auto TextReader::learn(cv::Mat const& field, std::string_view text) -> bool {
+    auto label = std::string{};
+    std::ranges::copy_if(text, std::back_inserter(label), [](char c) { return c != ' '; });
+    if (!std::ranges::all_of(label, [&](char c) { return alphabet_.find(c) != std::string::npos; })) {
+        return false;
+    }
+
+    auto const glyphs = segment(field);
+    if (glyphs.size() != label.size()) {
+        return false;
+    }
+    for (auto index = std::size_t{0}; index < glyphs.size(); ++index) {
+        glyphs_.addSample(label[index], glyphs[index]);
+    }
+    return true;
+}
+
+auto TextReader::read(cv::Mat const& field) const -> Result {
+    auto result = Result{};
+    auto const glyphs = segment(field);
+    if (glyphs.empty() || glyphs_.empty()) {
+        return result;
+    }
+
+    result.confidence = 1.0;
+    for (auto const& glyph : glyphs) {
+        auto const match = glyphs_.match(glyph);
+        result.text.push_back(static_cast<char>(match.label));
+        result.confidence = std::min(result.confidence, match.score);
+    }
+    return result;
+}
+
+} // namespace oraker
@@ -0,0 +1,118 @@
+#include <oraker/tiled_detector.hpp>
+
+#include <algorithm>
+
+namespace oraker {
+
+namespace {
+
+// Splits [begin, begin + length) into windows of at most `window` with `overlap` shared pixels,
+// the last window is aligned to the end so no piece is narrower than it needs to be.
+auto splitSpan(int begin, int length, int window, int overlap) {
+    auto starts = std::vector<int>{};
+    if (length <= window) {
+        starts.push_back(begin);
+        return starts;
+    }
+    auto const step = std::max(window - overlap, 1);
+    for (auto start = begin; ; start += step) {
+        if (start + window >= begin + length) {
+            starts.push_back(begin + length - window);
+            break;
+        }
+        starts.push_back(start);
+    }
+    return starts;
+}
+
+} // namespace
+
+TiledDetector::TiledDetector(Detector& detector, std::vector<TableRegion> regions, Options options)
+    : detector_{detector}
+    , regions_{std::move(regions)}
+    , options_{options} {
+}
+
+auto TiledDetector::setRegions(std::vector<TableRegion> regions) -> void {
+    regions_ = std::move(regions);
+    plannedFrameSize_ = {};
+}
+
+auto TiledDetector::plan(cv::Size frameSize) -> void {
+    auto const input = detector_.options().inputSize;
+    auto const frame = cv::Rect{cv::Point{}, frameSize};
+
+    auto pieces = std::vector<cv::Rect>{};
+    for (auto const& region : regions_) {
+        auto const clipped = region.rect & frame;
+        if (clipped.empty()) {
+            continue;
+        }
+        for (auto const y : splitSpan(clipped.y, clipped.height, input.height, options_.overlap)) {
+            for (auto const x : splitSpan(clipped.x, clipped.width, input.width, options_.overlap)) {
+                pieces.push_back(cv::Rect{x, y, std::min(clipped.width, input.width), std::min(clipped.height, input.height)});
+            }
+        }
+    }
+    std::ranges::sort(pieces, std::greater{}, &cv::Rect::height);
+
+    // Shelf packing: fill a row left to right, open a new shelf below it, then a new tile.
+    placements_.clear();
+    tileCount_ = pieces.empty() ? 0 : 1;
+    auto cursor = cv::Point{};
+    auto shelfHeight = 0;
+    for (auto const& piece : pieces) {
+        if (cursor.x + piece.width > input.width) {
+            cursor = {0, cursor.y + shelfHeight + options_.spacing};
+            shelfHeight = 0;
+        }
+        if (cursor.y + piece.height > input.height) {
+            cursor = {};
+            shelfHeight = 0;
+            ++tileCount_;
+        }
+        placements_.push_back({tileCount_ - 1, piece, cursor});
+        cursor.x += piece.width + options_.spacing;
+        shelfHeight = std::max(shelfHeight, piece.height);
+    }
+
+    tiles_.assign(tileCount_, cv::Mat{});
+    plannedFrameSize_ = frameSize;
+}
+
+auto TiledDetector::detect(cv::Mat const& frame) -> std::vector<Detection> {
+    if (frame.size() != plannedFrameSize_) {
+        plan(frame.size());
+    }
+    if (tileCount_ == 0) {
+        return {};
+    }
+
+    auto const input = detector_.options().inputSize;
+    for (auto& tile : tiles_) {
+        tile.create(input, frame.type());
+        tile.setTo(cv::Scalar{114, 114, 114});
+    }
+    for (auto const& placement : placements_) {
+        frame(placement.source).copyTo(tiles_[placement.tile](cv::Rect{placement.offset, placement.source.size()}));
+    }
+
+    auto const tileDetections = detector_.detectTiles(tiles_);
+
+    auto detections = std::vector<Detection>{};
+    for (auto const& placement : placements_) {
+        auto const area = cv::Rect2f{cv::Rect{placement.offset, placement.source.size()}};
+        auto const shift = cv::Point2f{placement.source.tl() - placement.offset};
+        for (auto detection : tileDetections[placement.tile]) {
+            auto const centre = (detection.box.tl() + detection.box.br()) * 0.5f;
+            if (!area.contains(centre)) {
+                continue;
+            }
+            detection.box = (detection.box & area) + shift;
+            detections.push_back(detection);
+        }
+    }
+    return suppressOverlaps(std::move(detections), options_.nmsThreshold);
+}
+
+} // namespace oraker
@@ -0,0 +1,163 @@
+#include <oraker/equity_session.hpp>
+#include <oraker/exact_equity.hpp>
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/range_equity.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Compares exact heads-up equity against brute force enumeration on flop and turn spots: both must agree
+// on every win, tie and loss count, and the speedup of suit isomorphism and threading is reported. Then
+// follows a range-vs-range hand from flop to river, where the incremental session must match a cold
+// evaluation on every street.
+
+struct Spot {
+    std::string hole;
+    std::string board;
+    std::string villain;
+};
+
+// Every board completion times every villain hand, evaluating both hands each time.
+auto bruteForce(oraker::CardMask hero, oraker::CardMask board, oraker::CardMask villain, int missing) {
+    auto deck = std::vector<oraker::CardMask>{};
+    for (auto index = 0; index < oraker::Card::COUNT; ++index) {
+        if (auto const mask = oraker::Card::fromIndex(index).mask(); ((hero | board | villain) & mask) == 0) {
+            deck.push_back(mask);
+        }
+    }
+    auto result = oraker::ExactEquity::Result{};
+    auto const compare = [&](oraker::CardMask fullBoard, oraker::CardMask hand) {
+        auto const heroValue = oraker::evaluateHand(hero | fullBoard);
+        auto const villainValue = oraker::evaluateHand(hand | fullBoard);
+        ++(heroValue > villainValue ? result.wins : heroValue == villainValue ? result.ties : result.losses);
+        ++result.evaluated;
+    };
+    auto const deal = [&](oraker::CardMask fullBoard) {
+        if (villain != 0) {
+            compare(fullBoard, villain);
+            return;
+        }
+        for (auto first = std::size_t{0}; first < deck.size(); ++first) {
+            for (auto second = first + 1; second < deck.size(); ++second) {
+                if (((deck[first] | deck[second]) & fullBoard) == 0) {
+                    compare(fullBoard, deck[first] | deck[second]);
+                }
+            }
+        }
+    };
+    auto const size = deck.size();
+    if (missing == 0) {
+        deal(board);
+    } else if (missing == 1) {
+        for (auto turn = std::size_t{0}; turn < size; ++turn) {
+            deal(board | deck[turn]);
+        }
+    } else if (missing == 2) {
+        for (auto turn = std::size_t{0}; turn < size; ++turn) {
+            for (auto river = turn + 1; river < size; ++river) {
+                deal(board | deck[turn] | deck[river]);
+            }
+        }
+    } else {
+        throw std::runtime_error("Brute force only covers flop and later spots");
+    }
+    return result;
+}
+
+auto cards(std::string const& text) {
+    auto parsed = oraker::parseCards(text);
+    if (!parsed) {
+        throw std::runtime_error("Invalid cards \"" + text + "\"");
+    }
+    return *parsed;
+}
+
+// Deals the turn and river into a session opened on the flop and times each update against evaluating
+// the new board from scratch.
+auto followStreets(int threads) {
+    auto const hero = oraker::Range::parse("AA, KK, QQ, AKs, AKo, AQs, KQs, QJs, JTs");
+    auto const villain = oraker::Range::parse("22+, A2s+, K9s+, Q9s+, J9s+, T9s, 98s, ATo+, KJo+, QJo");
+    auto board = cards("Qh7c2d");
+    auto const engine = oraker::RangeEquity{{.threads = threads}};
+    auto time = cv::TickMeter{};
+    time.start();
+    auto session = oraker::EquitySession{hero, villain, board, engine.options()};
+    time.stop();
+    std::cout << "session on " << board[0].toString() << board[1].toString() << board[2].toString() << ": " << time.getTimeSec() * 1e3 << " ms to open, "
+              << session.runouts().size() << " runouts\n";
+
+    auto passed = true;
+    for (auto const card : cards("5sKd")) {
+        board.push_back(card);
+        auto update = cv::TickMeter{};
+        update.start();
+        session.deal(card);
+        auto const incremental = session.equity();
+        update.stop();
+        auto const cold = engine.evaluate(hero, villain, board);
+        std::cout << "  " << card.toString() << ": " << 100.0 * incremental.equity << "%, update " << update.getTimeMicro() << " us, cold "
+                  << cold.seconds * 1e6 << " us, " << cold.seconds / update.getTimeSec() << "x\n";
+        if (std::abs(incremental.equity - cold.equity) > 1e-9) {
+            std::cerr << "  mismatch: session " << incremental.equity << " against cold " << cold.equity << '\n';
+            passed = false;
+        }
+    }
+    return passed;
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h  |   | print this message}"
+        "{threads | 0 | threads of the parallel run, 0 uses every hardware thread}"};
+    if (parser.has("help")) {
+        parser.printMessage();
+        return 0;
+    }
+
+    auto const spots = std::vector<Spot>{
+        {"AhKh", "Qh7h2h", ""},
+        {"AhKh", "Qh7c2d", ""},
+        {"8s8d", "Ts9s2h", ""},
+        {"AsKd", "KhKc7s", ""},
+        {"JcTc", "9c8d2h3s", ""},
+        {"AhKh", "Qh7c2d", "8s8d"},
+    };
+    auto passed = true;
+    try {
+        for (auto const& spot : spots) {
+            auto const hole = cards(spot.hole);
+            auto const board = cards(spot.board);
+            auto const villain = cards(spot.villain);
+
+            auto time = cv::TickMeter{};
+            time.start();
+            auto const reference = bruteForce(oraker::handMask(hole), oraker::handMask(board), oraker::handMask(villain), static_cast<int>(5 - board.size()));
+            time.stop();
+            auto const bruteSeconds = time.getTimeSec();
+            auto const serial = oraker::ExactEquity{{.threads = 1}}.evaluate(hole, board, villain);
+            auto const parallel = oraker::ExactEquity{{.threads = parser.get<int>("threads")}}.evaluate(hole, board, villain);
+
+            std::cout << spot.hole << " vs " << (spot.villain.empty() ? "random" : spot.villain) << " on " << spot.board << ": "
+                      << 100.0 * parallel.equity() << "% (" << parallel.wins << '/' << parallel.ties << '/' << parallel.losses << ")\n"
+                      << "  brute force " << bruteSeconds * 1e3 << " ms, " << reference.evaluated << " deals\n"
+                      << "  isomorphism " << serial.seconds * 1e3 << " ms, " << serial.evaluated << " deals, " << bruteSeconds / serial.seconds << "x\n"
+                      << "  " << parallel.threads << " threads   " << parallel.seconds * 1e3 << " ms, " << bruteSeconds / parallel.seconds << "x\n";
+            for (auto const& result : {serial, parallel}) {
+                if (result.wins != reference.wins || result.ties != reference.ties || result.losses != reference.losses) {
+                    std::cerr << "  mismatch: " << result.wins << '/' << result.ties << '/' << result.losses << " against brute force "
+                              << reference.wins << '/' << reference.ties << '/' << reference.losses << '\n';
+                    passed = false;
+                }
+            }
+        }
+        passed = followStreets(parser.get<int>("threads")) && passed;
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+    return passed ? 0 : 1;
+}
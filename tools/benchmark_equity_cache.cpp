@@ -0,0 +1,138 @@
+#include <oraker/equity.hpp>
+#include <oraker/equity_cache.hpp>
+#include <oraker/xoshiro.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+// Plays random hands on several tables at once, each asking a shared equity cache for hero's preflop and
+// flop equity, and reports the hit rate, memory use and time saved. Also checks that canonical keys do
+// not change under suit permutations.
+
+// Every suit permutation of random situations must give the same key.
+auto checkCanonical(unsigned seed) {
+    auto random = oraker::Xoshiro256{seed, 0};
+    auto deck = std::array<int, oraker::Card::COUNT>{};
+    auto suits = std::array<int, 4>{0, 1, 2, 3};
+    for (auto situation = 0; situation < 1'000; ++situation) {
+        std::iota(deck.begin(), deck.end(), 0);
+        for (auto i = std::size_t{0}; i < 7; ++i) {
+            std::swap(deck[i], deck[i + random.below(static_cast<std::uint32_t>(deck.size() - i))]);
+        }
+        auto const boardSize = static_cast<std::size_t>(situation % 4 == 0 ? 0 : 2 + situation % 4);
+        auto const key = [&](std::array<int, 4> const& target) {
+            auto cards = std::array<oraker::Card, 7>{};
+            for (auto i = std::size_t{0}; i < cards.size(); ++i) {
+                auto const card = oraker::Card::fromIndex(deck[i]);
+                cards[i] = oraker::Card{card.rank(), target[static_cast<std::size_t>(card.suit())]};
+            }
+            return oraker::canonicalSituation(std::span{cards}.first(2), std::span{cards}.subspan(2, boardSize), 2);
+        };
+        auto const reference = key(suits);
+        do {
+            if (key(suits) != reference) {
+                std::cerr << "Canonical key changes under a suit permutation\n";
+                return false;
+            }
+        } while (std::ranges::next_permutation(suits).found);
+    }
+    return true;
+}
+
+struct TableTally {
+    std::size_t queries = 0;
+    std::size_t computed = 0;
+    double computeSeconds = 0.0;
+};
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h   |       | print this message}"
+        "{tables   | 4     | tables played at once, one thread each}"
+        "{hands    | 2000  | hands per table}"
+        "{capacity | 65536 | cached situations}"
+        "{shards   | 16    | independently locked cache shards}"
+        "{width    | 0.02  | confidence interval width asked for}"
+        "{seed     | 1     | random seed}"};
+    if (parser.has("help")) {
+        parser.printMessage();
+        return 0;
+    }
+
+    if (!checkCanonical(parser.get<unsigned>("seed"))) {
+        return 1;
+    }
+    try {
+        auto cache = oraker::EquityCache{{.capacity = static_cast<std::size_t>(parser.get<int>("capacity")), .shards = parser.get<int>("shards")}};
+        auto const width = parser.get<double>("width");
+        auto const engine = oraker::MonteCarloEquity{{.threads = 1, .seed = parser.get<unsigned>("seed"), .confidenceWidth = width}};
+        auto const tables = parser.get<int>("tables");
+        auto const hands = parser.get<int>("hands");
+        auto tallies = std::vector<TableTally>(static_cast<std::size_t>(tables));
+
+        auto const play = [&](std::size_t table) {
+            auto random = oraker::Xoshiro256{parser.get<unsigned>("seed"), table + 1};
+            auto deck = std::array<oraker::Card, oraker::Card::COUNT>{};
+            auto& tally = tallies[table];
+            auto const ask = [&](std::span<oraker::Card const> hole, std::span<oraker::Card const> board, int opponents) {
+                ++tally.queries;
+                cache.getOrCompute(oraker::canonicalSituation(hole, board, opponents), width / 2, [&] {
+                    auto const equity = engine.estimate(hole, board, opponents);
+                    ++tally.computed;
+                    tally.computeSeconds += equity.seconds;
+                    return equity;
+                });
+            };
+            for (auto hand = 0; hand < hands; ++hand) {
+                for (auto index = 0; index < oraker::Card::COUNT; ++index) {
+                    deck[static_cast<std::size_t>(index)] = oraker::Card::fromIndex(index);
+                }
+                for (auto i = std::size_t{0}; i < 5; ++i) {
+                    std::swap(deck[i], deck[i + random.below(static_cast<std::uint32_t>(deck.size() - i))]);
+                }
+                // Most pots shrink to one or two opponents by the flop.
+                auto const opponents = 1 + static_cast<int>(random.below(5));
+                ask(std::span{deck}.first(2), {}, opponents);
+                ask(std::span{deck}.first(2), std::span{deck}.subspan(2, 3), std::min(opponents, 1 + static_cast<int>(random.below(2))));
+            }
+        };
+
+        auto const started = std::chrono::steady_clock::now();
+        auto workers = std::vector<std::thread>{};
+        for (auto table = 1; table < tables; ++table) {
+            workers.emplace_back(play, static_cast<std::size_t>(table));
+        }
+        play(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+        auto total = TableTally{};
+        for (auto const& tally : tallies) {
+            total.queries += tally.queries;
+            total.computed += tally.computed;
+            total.computeSeconds += tally.computeSeconds;
+        }
+        auto const statistics = cache.statistics();
+        auto const perCompute = total.computed == 0 ? 0.0 : total.computeSeconds / static_cast<double>(total.computed);
+        std::cout << "queries:    " << total.queries << " from " << tables << " tables in " << seconds << " s\n"
+                  << "hit rate:   " << 100.0 * statistics.hitRate() << "% (" << statistics.hits << " hits, " << statistics.misses << " misses, "
+                  << statistics.imprecise << " too imprecise)\n"
+                  << "entries:    " << statistics.entries << ", " << statistics.evictions << " evicted\n"
+                  << "memory:     " << static_cast<double>(statistics.memoryBytes) / (1 << 20) << " MiB, "
+                  << (statistics.entries == 0 ? 0 : statistics.memoryBytes / statistics.entries) << " bytes per entry\n"
+                  << "simulation: " << perCompute * 1e3 << " ms per miss, "
+                  << perCompute * static_cast<double>(total.queries - total.computed) << " s saved by hits\n";
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include <oraker/hand_evaluator.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Checks the 7-card evaluator against every one of the C(52, 7) hands and measures its throughput. The
+// exhaustive pass must reproduce the known category counts and the 4824 distinct hand values, and every
+// SIMD batch kernel the CPU supports must agree with the scalar evaluator on every hand.
+
+constexpr auto EXPECTED_COUNTS = std::array<std::uint64_t, 9>{
+    23294460, 58627800, 31433400, 6461620, 6180020, 4047644, 3473184, 224848, 41584};
+constexpr auto EXPECTED_VALUES = std::size_t{4824};
+
+auto levelName(oraker::SimdLevel level) {
+    switch (level) {
+    case oraker::SimdLevel::AVX512:
+        return "avx-512";
+    case oraker::SimdLevel::AVX2:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+// Batch levels worth checking and timing on this CPU, scalar first.
+auto supportedLevels() {
+    auto levels = std::vector<oraker::SimdLevel>{};
+    for (auto const level : {oraker::SimdLevel::SCALAR, oraker::SimdLevel::AVX2, oraker::SimdLevel::AVX512}) {
+        if (level <= oraker::simdLevel()) {
+            levels.push_back(level);
+        }
+    }
+    return levels;
+}
+
+auto exhaustive() -> bool {
+    auto counts = std::array<std::uint64_t, 9>{};
+    auto seen = std::vector<bool>(std::size_t{1} << 28);
+    auto time = cv::TickMeter{};
+    auto const mask = [](int index) { return oraker::Card::fromIndex(index).mask(); };
+
+    // Hands are batched so every SIMD level can be compared to the scalar values.
+    auto const levels = supportedLevels();
+    auto batch = std::vector<oraker::CardMask>{};
+    auto scalar = std::vector<oraker::HandValue>{};
+    auto simd = std::vector<oraker::HandValue>{};
+    auto mismatches = std::uint64_t{0};
+    auto const checkBatch = [&] {
+        simd.resize(batch.size());
+        for (auto const level : levels | std::views::drop(1)) {
+            oraker::evaluateHands(batch, 0, simd, level);
+            mismatches += static_cast<std::uint64_t>(std::ranges::mismatch(scalar, simd).in1 != scalar.end());
+        }
+        batch.clear();
+        scalar.clear();
+    };
+
+    time.start();
+    for (auto a = 0; a < oraker::Card::COUNT; ++a)
+    for (auto b = a + 1; b < oraker::Card::COUNT; ++b)
+    for (auto c = b + 1; c < oraker::Card::COUNT; ++c)
+    for (auto d = c + 1; d < oraker::Card::COUNT; ++d) {
+        auto const four = mask(a) | mask(b) | mask(c) | mask(d);
+        for (auto e = d + 1; e < oraker::Card::COUNT; ++e)
+        for (auto f = e + 1; f < oraker::Card::COUNT; ++f)
+        for (auto g = f + 1; g < oraker::Card::COUNT; ++g) {
+            auto const hand = four | mask(e) | mask(f) | mask(g);
+            auto const value = oraker::evaluateHand(hand);
+            ++counts[static_cast<std::size_t>(oraker::handCategory(value))];
+            seen[value] = true;
+            if (levels.size() > 1) {
+                batch.push_back(hand);
+                scalar.push_back(value);
+                if (batch.size() == 4096) {
+                    checkBatch();
+                }
+            }
+        }
+    }
+    checkBatch();
+    time.stop();
+
+    auto passed = mismatches == 0;
+    if (!passed) {
+        std::cerr << mismatches << " batches where SIMD and scalar evaluation disagree\n";
+    }
+    for (auto category = std::size_t{0}; category < counts.size(); ++category) {
+        auto const name = oraker::categoryName(static_cast<oraker::HandCategory>(category));
+        std::cout << name << ": " << counts[category] << '\n';
+        if (counts[category] != EXPECTED_COUNTS[category]) {
+            std::cerr << "Expected " << EXPECTED_COUNTS[category] << ' ' << name << " hands\n";
+            passed = false;
+        }
+    }
+    auto const values = static_cast<std::size_t>(std::count(seen.begin(), seen.end(), true));
+    std::cout << "distinct values: " << values << '\n';
+    if (values != EXPECTED_VALUES) {
+        std::cerr << "Expected " << EXPECTED_VALUES << " distinct values\n";
+        passed = false;
+    }
+    auto const hands = std::accumulate(counts.begin(), counts.end(), std::uint64_t{0});
+    std::cout << "exhaustive: " << hands << " hands in " << time.getTimeSec() << " s, "
+              << time.getTimeSec() * 1e9 / static_cast<double>(hands) << " ns/hand\n";
+    return passed;
+}
+
+// Random hands defeat the branch predictor the way equity simulation does, unlike the ordered enumeration.
+auto benchmark(int hands, int passes, unsigned seed) {
+    auto generator = std::mt19937_64{seed};
+    auto deck = std::array<int, oraker::Card::COUNT>{};
+    std::iota(deck.begin(), deck.end(), 0);
+    auto masks = std::vector<oraker::CardMask>(static_cast<std::size_t>(hands));
+    for (auto& mask : masks) {
+        for (auto i = 0; i < 7; ++i) {
+            std::swap(deck[static_cast<std::size_t>(i)], deck[std::uniform_int_distribution<std::size_t>{static_cast<std::size_t>(i), deck.size() - 1}(generator)]);
+            mask |= oraker::Card::fromIndex(deck[static_cast<std::size_t>(i)]).mask();
+        }
+    }
+
+    auto const evaluated = static_cast<double>(hands) * passes;
+    auto const report = [&](std::string_view name, cv::TickMeter const& time, oraker::HandValue checksum) {
+        std::cout << "random " << name << ": " << evaluated / time.getTimeSec() / 1e6 << " M hands/s, " << time.getTimeSec() * 1e9 / evaluated
+                  << " ns/hand (checksum " << checksum << ")\n";
+    };
+
+    auto time = cv::TickMeter{};
+    auto checksum = oraker::HandValue{0};
+    time.start();
+    for (auto pass = 0; pass < passes; ++pass) {
+        for (auto const mask : masks) {
+            checksum += oraker::evaluateHand(mask);
+        }
+    }
+    time.stop();
+    report("one by one", time, checksum);
+
+    auto values = std::vector<oraker::HandValue>(masks.size());
+    for (auto const level : supportedLevels()) {
+        auto batchTime = cv::TickMeter{};
+        auto batchChecksum = oraker::HandValue{0};
+        batchTime.start();
+        for (auto pass = 0; pass < passes; ++pass) {
+            oraker::evaluateHands(masks, 0, values, level);
+            batchChecksum = std::accumulate(values.begin(), values.end(), batchChecksum);
+        }
+        batchTime.stop();
+        report(std::string{"batch "} + levelName(level), batchTime, batchChecksum);
+    }
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h     |         | print this message}"
+        "{hands      | 1048576 | random hands per benchmark pass}"
+        "{passes     | 20      | benchmark passes over the random hands}"
+        "{seed       | 1       | random hand seed}"
+        "{skip-check |         | skip the exhaustive correctness pass}"};
+    if (parser.has("help")) {
+        parser.printMessage();
+        return 0;
+    }
+
+    auto const passed = parser.has("skip-check") || exhaustive();
+    benchmark(parser.get<int>("hands"), parser.get<int>("passes"), parser.get<unsigned>("seed"));
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+#include <oraker/equity.hpp>
+#include <oraker/exact_equity.hpp>
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/omaha_evaluator.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Checks the pruned Omaha evaluator against all 60 or 100 combinations on random hands and exact Omaha
+// equity against brute force enumeration, then reports how far Omaha evaluation and Monte Carlo equity
+// run behind Hold'em.
+
+struct Deal {
+    oraker::CardMask hole = 0;
+    oraker::CardMask board = 0;
+};
+
+// Random hole cards and a full board; the lowest two hole cards double as a Hold'em hand.
+auto randomDeals(int count, int holeCards, unsigned seed) {
+    auto generator = std::mt19937_64{seed};
+    auto deck = std::array<int, oraker::Card::COUNT>{};
+    std::iota(deck.begin(), deck.end(), 0);
+    auto deals = std::vector<Deal>(static_cast<std::size_t>(count));
+    for (auto& deal : deals) {
+        for (auto i = 0; i < holeCards + 5; ++i) {
+            std::swap(deck[static_cast<std::size_t>(i)], deck[std::uniform_int_distribution<std::size_t>{static_cast<std::size_t>(i), deck.size() - 1}(generator)]);
+            (i < holeCards ? deal.hole : deal.board) |= oraker::Card::fromIndex(deck[static_cast<std::size_t>(i)]).mask();
+        }
+    }
+    return deals;
+}
+
+template<typename Evaluate>
+auto nanosecondsPerHand(std::vector<Deal> const& deals, Evaluate const& evaluate) {
+    auto time = cv::TickMeter{};
+    auto checksum = oraker::HandValue{0};
+    time.start();
+    for (auto const& deal : deals) {
+        checksum += evaluate(deal);
+    }
+    time.stop();
+    // Printed so the loop cannot be optimised away.
+    std::cout << "  (checksum " << checksum << ")\n";
+    return time.getTimeSec() * 1e9 / static_cast<double>(deals.size());
+}
+
+auto evaluators(int hands, unsigned seed) {
+    auto passed = true;
+    for (auto const holeCards : {4, 5}) {
+        auto const deals = randomDeals(hands, holeCards, seed);
+        auto const mismatches = std::ranges::count_if(deals, [](Deal const& deal) {
+            return oraker::evaluateOmaha(deal.hole, deal.board) != oraker::evaluateOmahaExhaustive(deal.hole, deal.board);
+        });
+        if (mismatches != 0) {
+            std::cerr << mismatches << " hands where pruned and exhaustive " << holeCards << "-card Omaha evaluation disagree\n";
+            passed = false;
+        }
+        std::cout << holeCards << "-card Omaha, " << hands << " random hands:\n";
+        auto const holdem = nanosecondsPerHand(deals, [](Deal const& deal) {
+            auto const first = deal.hole & -deal.hole;
+            auto const rest = deal.hole ^ first;
+            return oraker::evaluateHand(first | (rest & -rest) | deal.board);
+        });
+        auto const pruned = nanosecondsPerHand(deals, [](Deal const& deal) { return oraker::evaluateOmaha(deal.hole, deal.board); });
+        auto const exhaustive = nanosecondsPerHand(deals, [](Deal const& deal) { return oraker::evaluateOmahaExhaustive(deal.hole, deal.board); });
+        std::cout << "  hold'em 7 cards " << holdem << " ns/hand\n"
+                  << "  pruned          " << pruned << " ns/hand, " << pruned / holdem << "x behind hold'em\n"
+                  << "  exhaustive      " << exhaustive << " ns/hand, " << exhaustive / pruned << "x slower than pruned\n";
+    }
+    return passed;
+}
+
+// Every board completion, evaluating both hands with all combinations.
+auto bruteForce(oraker::CardMask hero, oraker::CardMask board, oraker::CardMask villain, int missing) {
+    auto deck = std::vector<oraker::CardMask>{};
+    for (auto index = 0; index < oraker::Card::COUNT; ++index) {
+        if (auto const mask = oraker::Card::fromIndex(index).mask(); ((hero | board | villain) & mask) == 0) {
+            deck.push_back(mask);
+        }
+    }
+    auto result = oraker::ExactEquity::Result{};
+    auto const deal = [&](oraker::CardMask fullBoard) {
+        auto const heroValue = oraker::evaluateOmahaExhaustive(hero, fullBoard);
+        auto const villainValue = oraker::evaluateOmahaExhaustive(villain, fullBoard);
+        ++(heroValue > villainValue ? result.wins : heroValue == villainValue ? result.ties : result.losses);
+        ++result.evaluated;
+    };
+    if (missing == 1) {
+        for (auto const turn : deck) {
+            deal(board | turn);
+        }
+    } else if (missing == 2) {
+        for (auto turn = std::size_t{0}; turn < deck.size(); ++turn) {
+            for (auto river = turn + 1; river < deck.size(); ++river) {
+                deal(board | deck[turn] | deck[river]);
+            }
+        }
+    } else {
+        throw std::runtime_error("Brute force only covers flop and turn spots");
+    }
+    return result;
+}
+
+auto cards(std::string const& text) {
+    auto parsed = oraker::parseCards(text);
+    if (!parsed) {
+        throw std::runtime_error("Invalid cards \"" + text + "\"");
+    }
+    return *parsed;
+}
+
+auto exact(int threads) {
+    struct Spot {
+        std::string hole;
+        std::string board;
+        std::string villain;
+    };
+    auto const spots = std::vector<Spot>{
+        {"AsKsQhJh", "Ts6h2c", "9c9d8c7d"},
+        {"AhAd7s6s", "Kh8s5c", "KdQcJsTs"},
+        {"AcKc5d4d3h", "Qc8c2s9h", "JsJhTd7d6d"},
+    };
+    auto passed = true;
+    for (auto const& spot : spots) {
+        auto const hole = cards(spot.hole);
+        auto const board = cards(spot.board);
+        auto const villain = cards(spot.villain);
+        auto time = cv::TickMeter{};
+        time.start();
+        auto const reference = bruteForce(oraker::handMask(hole), oraker::handMask(board), oraker::handMask(villain), static_cast<int>(5 - board.size()));
+        time.stop();
+        auto const result = oraker::ExactEquity{{.threads = threads}}.evaluate(hole, board, villain);
+        std::cout << spot.hole << " vs " << spot.villain << " on " << spot.board << ": " << 100.0 * result.equity() << "%, "
+                  << result.seconds * 1e3 << " ms, brute force " << time.getTimeSec() * 1e3 << " ms\n";
+        if (result.wins != reference.wins || result.ties != reference.ties || result.losses != reference.losses) {
+            std::cerr << "  mismatch: " << result.wins << '/' << result.ties << '/' << result.losses << " against brute force "
+                      << reference.wins << '/' << reference.ties << '/' << reference.losses << '\n';
+            passed = false;
+        }
+    }
+    return passed;
+}
+
+// Simulated hands per second and core for the same number of hands in each game.
+auto simulation(int threads, std::uint64_t hands) {
+    auto const engine = oraker::MonteCarloEquity{{.threads = threads, .confidenceWidth = 0.0, .maxHands = hands}};
+    auto holdem = 0.0;
+    for (auto const& [name, hole] : {std::pair{"hold'em", "AhKh"}, std::pair{"omaha", "AsKsQhJh"}, std::pair{"5-card omaha", "AcKc5d4d3h"}}) {
+        auto const result = engine.estimate(cards(hole), {}, 1);
+        auto const rate = result.handsPerSecondPerCore();
+        holdem = holdem == 0.0 ? rate : holdem;
+        std::cout << name << ' ' << hole << " vs 1 random: " << 100.0 * result.equity << "% +- " << 100.0 * result.halfWidth << ", "
+                  << rate / 1e6 << " M hands/s/core, " << holdem / rate << "x behind hold'em\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h  |         | print this message}"
+        "{hands   | 1000000 | random hands per evaluator benchmark}"
+        "{sims    | 2000000 | simulated hands per equity benchmark}"
+        "{seed    | 1       | random hand seed}"
+        "{threads | 0       | equity threads, 0 uses every hardware thread}"};
+    if (parser.has("help")) {
+        parser.printMessage();
+        return 0;
+    }
+
+    try {
+        auto const passed = evaluators(parser.get<int>("hands"), parser.get<unsigned>("seed")) & exact(parser.get<int>("threads"));
+        simulation(parser.get<int>("threads"), static_cast<std::uint64_t>(parser.get<double>("sims")));
+        return passed ? 0 : 1;
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+}
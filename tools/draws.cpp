@@ -0,0 +1,135 @@
+#include <oraker/draw_analysis.hpp>
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/xoshiro.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Reports hero's made hand, outs, draws and the equity after each possible next card, e.g.
+// "oraker-draws AhKh --board=Qh7h2c", with the time each analysis takes. --spots times both analyses
+// on random flops and turns instead.
+
+auto cardsArgument(cv::CommandLineParser const& parser, std::string const& name) {
+    auto const text = parser.get<std::string>(name);
+    auto cards = oraker::parseCards(text);
+    if (!cards) {
+        throw std::runtime_error("Invalid cards \"" + text + "\"");
+    }
+    return *cards;
+}
+
+auto straightDrawName(oraker::StraightDraw draw) {
+    switch (draw) {
+    case oraker::StraightDraw::OPEN_ENDED:
+        return "open-ended";
+    case oraker::StraightDraw::GUTSHOT:
+        return "gutshot";
+    default:
+        return "none";
+    }
+}
+
+auto report(std::vector<oraker::Card> const& hole, std::vector<oraker::Card> const& board) {
+    auto time = cv::TickMeter{};
+    time.start();
+    auto const analysis = oraker::analyzeDraws(hole, board);
+    time.stop();
+    auto nextTime = cv::TickMeter{};
+    nextTime.start();
+    auto const equities = oraker::nextCardEquity(hole, board);
+    nextTime.stop();
+
+    std::cout << "made:       " << oraker::categoryName(oraker::handCategory(analysis.made)) << '\n' << "outs:       " << analysis.outCount;
+    for (auto index = 0; index < oraker::Card::COUNT; ++index) {
+        if ((analysis.outs & oraker::Card::fromIndex(index).mask()) != 0) {
+            std::cout << ' ' << oraker::Card::fromIndex(index).toString();
+        }
+    }
+    std::cout << '\n';
+    for (auto category = std::size_t{0}; category < analysis.outsByCategory.size(); ++category) {
+        if (analysis.outsByCategory[category] != 0) {
+            std::cout << "  " << oraker::categoryName(static_cast<oraker::HandCategory>(category)) << ": " << analysis.outsByCategory[category] << '\n';
+        }
+    }
+    std::cout << "flush draw: " << (analysis.flushDraw ? analysis.nutFlushDraw ? "nut" : "yes" : analysis.backdoorFlushDraw ? "backdoor" : "no") << '\n'
+              << "straight:   " << straightDrawName(analysis.straightDraw) << (analysis.nutStraightDraw ? ", nut" : "") << '\n'
+              << "combo draw: " << (analysis.comboDraw() ? "yes" : "no") << '\n';
+
+    auto live = std::vector<int>{};
+    for (auto index = 0; index < oraker::Card::COUNT; ++index) {
+        if (equities[static_cast<std::size_t>(index)] >= 0.0f) {
+            live.push_back(index);
+        }
+    }
+    std::ranges::sort(live, std::greater{}, [&](int index) { return equities[static_cast<std::size_t>(index)]; });
+    auto const mean = std::accumulate(live.begin(), live.end(), 0.0, [&](double sum, int index) { return sum + equities[static_cast<std::size_t>(index)]; })
+        / static_cast<double>(live.size());
+    std::cout << "next card:  " << 100.0 * mean << "% on average vs a random hand, best";
+    for (auto const index : live | std::views::take(3)) {
+        std::cout << ' ' << oraker::Card::fromIndex(index).toString() << ' ' << 100.0 * equities[static_cast<std::size_t>(index)] << '%';
+    }
+    std::cout << ", worst";
+    for (auto const index : live | std::views::reverse | std::views::take(3)) {
+        std::cout << ' ' << oraker::Card::fromIndex(index).toString() << ' ' << 100.0 * equities[static_cast<std::size_t>(index)] << '%';
+    }
+    std::cout << '\n' << "time:       " << time.getTimeMicro() << " us draws, " << nextTime.getTimeMicro() << " us next card\n";
+}
+
+auto benchmark(int spots, unsigned seed) {
+    auto random = oraker::Xoshiro256{seed, 0};
+    auto deck = std::array<oraker::Card, oraker::Card::COUNT>{};
+    auto draws = cv::TickMeter{};
+    auto next = cv::TickMeter{};
+    auto checksum = 0.0;
+    for (auto spot = 0; spot < spots; ++spot) {
+        for (auto index = 0; index < oraker::Card::COUNT; ++index) {
+            deck[static_cast<std::size_t>(index)] = oraker::Card::fromIndex(index);
+        }
+        for (auto i = std::size_t{0}; i < 6; ++i) {
+            std::swap(deck[i], deck[i + random.below(static_cast<std::uint32_t>(deck.size() - i))]);
+        }
+        auto const hole = std::span{deck}.first(2);
+        auto const board = std::span{deck}.subspan(2, spot % 2 == 0 ? 3 : 4);
+        draws.start();
+        checksum += oraker::analyzeDraws(hole, board).outCount;
+        draws.stop();
+        next.start();
+        checksum += oraker::nextCardEquity(hole, board)[0];
+        next.stop();
+    }
+    std::cout << spots << " random flops and turns (checksum " << checksum << ")\n"
+              << "draws:      " << draws.getTimeMicro() / spots << " us per spot\n"
+              << "next card:  " << next.getTimeMicro() / spots << " us per spot\n";
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h |   | print this message}"
+        "{@hole  |   | hero's hole cards, e.g. AhKh}"
+        "{board  |   | flop or turn, e.g. Qh7h2c}"
+        "{spots  | 0 | times this many random spots instead}"
+        "{seed   | 1 | random spot seed}"};
+    if (parser.has("help") || (parser.get<int>("spots") == 0 && (!parser.has("@hole") || !parser.has("board")))) {
+        parser.printMessage();
+        return parser.has("help") ? 0 : 2;
+    }
+
+    try {
+        if (parser.get<int>("spots") > 0) {
+            benchmark(parser.get<int>("spots"), parser.get<unsigned>("seed"));
+        } else {
+            report(cardsArgument(parser, "@hole"), cardsArgument(parser, "board"));
+        }
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
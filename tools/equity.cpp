@@ -0,0 +1,84 @@
+#include <oraker/equity.hpp>
+#include <oraker/hand_evaluator.hpp>
+#include <oraker/preflop_table.hpp>
+#include <oraker/range_equity.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+// Estimates equity for a hand from the command line and reports simulation throughput, e.g.
+// "oraker-equity AhKh --board=Qh7c2d --opponents=2", or of one range against another with
+// "oraker-equity \"TT+, AKs\" --range=\"22+, A2s+, KTs+, ATo+\"".
+
+auto cardsArgument(cv::CommandLineParser const& parser, std::string const& name) {
+    auto const text = parser.get<std::string>(name);
+    auto cards = oraker::parseCards(text);
+    if (!cards) {
+        throw std::runtime_error("Invalid cards \"" + text + "\"");
+    }
+    return *cards;
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h    |          | print this message}"
+        "{@hole     |          | hero's hole cards, e.g. AhKh or four or five for Omaha, or hero's range with --range}"
+        "{board     |          | known board cards, e.g. Qh7c2d}"
+        "{opponents | 1        | opponents holding random hands}"
+        "{range     |          | villain's range, e.g. \"TT+, AKs, A5s-A2s\"; compares ranges instead}"
+        "{preflop   |          | preflop equity table from oraker-generate-preflop, looked up instead of simulated without a board}"
+        "{threads   | 0        | simulation threads, 0 uses every hardware thread}"
+        "{seed      | 1        | random seed, equal seeds give equal results on any thread count}"
+        "{width     | 0.01     | stop once the 95% confidence interval is narrower, 0 runs max-hands}"
+        "{max-hands | 10000000 | simulated hands at most}"
+        "{budget    | 0        | time limit in milliseconds, 0 for none}"};
+    if (parser.has("help") || !parser.has("@hole")) {
+        parser.printMessage();
+        return parser.has("help") ? 0 : 2;
+    }
+
+    try {
+        auto const board = parser.has("board") ? cardsArgument(parser, "board") : std::vector<oraker::Card>{};
+        if (parser.has("range")) {
+            auto const engine = oraker::RangeEquity{{.threads = parser.get<int>("threads"), .seed = parser.get<unsigned>("seed")}};
+            auto const result = engine.evaluate(oraker::Range::parse(parser.get<std::string>("@hole")), oraker::Range::parse(parser.get<std::string>("range")), board);
+            std::cout << "equity:     " << 100.0 * result.equity << "% +- " << 100.0 * result.halfWidth << '\n'
+                      << "win:        " << 100.0 * result.win << "%\n"
+                      << "tie:        " << 100.0 * result.tie << "%\n"
+                      << "boards:     " << result.boards << (result.exact ? " enumerated" : " sampled") << " in " << result.seconds * 1e3
+                      << " ms on " << result.threads << " threads\n";
+            return 0;
+        }
+        auto const hole = cardsArgument(parser, "@hole");
+        if (parser.has("preflop") && board.empty() && hole.size() == 2) {
+            auto time = cv::TickMeter{};
+            time.start();
+            auto const table = oraker::PreflopTable{parser.get<std::string>("preflop")};
+            auto const equity = table.equity(hole[0], hole[1], parser.get<int>("opponents"));
+            time.stop();
+            std::cout << "equity:     " << 100.0 * equity << "% (" << oraker::PreflopTable::className(oraker::PreflopTable::classIndex(hole[0], hole[1]))
+                      << ", table of " << table.hands() << " hands per entry)\n"
+                      << "lookup:     " << time.getTimeMicro() << " us including mapping\n";
+            return 0;
+        }
+        auto const engine = oraker::MonteCarloEquity{{
+            .threads = parser.get<int>("threads"),
+            .seed = parser.get<unsigned>("seed"),
+            .confidenceWidth = parser.get<double>("width"),
+            .maxHands = static_cast<std::uint64_t>(parser.get<double>("max-hands")),
+            .budget = std::chrono::milliseconds{parser.get<int>("budget")},
+        }};
+        auto const result = engine.estimate(hole, board, parser.get<int>("opponents"));
+        std::cout << "equity:     " << 100.0 * result.equity << "% +- " << 100.0 * result.halfWidth << '\n'
+                  << "win:        " << 100.0 * result.win << "%\n"
+                  << "tie:        " << 100.0 * result.tie << "%\n"
+                  << "hands:      " << result.hands << " in " << result.seconds * 1e3 << " ms on " << result.threads << " threads\n"
+                  << "throughput: " << result.handsPerSecondPerCore() / 1e6 << " M hands/s/core\n";
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
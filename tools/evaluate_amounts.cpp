@@ -0,0 +1,105 @@
+#include <oraker/amount_reader.hpp>
+#include <oraker/seat_names.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+// Measures amount or player name reading accuracy and latency on labelled field crops. A directory of
+// crops holds the images plus labels.txt with one "<filename> <text>" line per crop, e.g. "pot_0001.png 1,250".
+
+auto loadLabels(std::filesystem::path const& directory) {
+    auto file = std::ifstream{directory / "labels.txt"};
+    if (!file) {
+        throw std::runtime_error("Failed to open " + (directory / "labels.txt").string());
+    }
+    auto labels = std::vector<std::pair<std::filesystem::path, std::string>>{};
+    auto filename = std::string{};
+    auto text = std::string{};
+    while (file >> filename >> text) {
+        labels.emplace_back(directory / filename, text);
+    }
+    return labels;
+}
+
+template<typename Reader>
+auto evaluate(Reader reader, cv::CommandLineParser const& parser) -> int {
+    if (parser.has("train")) {
+        for (auto const& [path, text] : loadLabels(parser.get<std::string>("train"))) {
+            if (!reader.learn(cv::imread(path.string()), text)) {
+                std::cerr << "Segmentation of " << path << " disagrees with \"" << text << "\", skipped\n";
+            }
+        }
+        if (parser.has("save")) {
+            reader.save(parser.get<std::string>("save"));
+        }
+    }
+
+    auto const labels = loadLabels(parser.get<std::string>("@crops"));
+    auto time = cv::TickMeter{};
+    auto fields = std::size_t{0};
+    auto correct = std::size_t{0};
+    auto confident = std::size_t{0};
+    for (auto const& [path, text] : labels) {
+        auto const field = cv::imread(path.string());
+        if (field.empty()) {
+            std::cerr << "Skipping unreadable crop " << path << '\n';
+            continue;
+        }
+        time.start();
+        auto const result = reader.read(field);
+        time.stop();
+
+        ++fields;
+        if constexpr (requires { result.value; }) {
+            confident += result.value.has_value();
+        } else {
+            confident += result.confidence >= reader.options().minScore;
+        }
+        if (result.text == text) {
+            ++correct;
+        } else {
+            std::cerr << path.filename().string() << ": read \"" << result.text << "\", expected \"" << text << "\"\n";
+        }
+    }
+    if (fields == 0) {
+        std::cerr << "No readable crops\n";
+        return 2;
+    }
+
+    auto const accuracy = static_cast<double>(correct) / fields;
+    std::cout << "fields:    " << fields << '\n'
+              << "accuracy:  " << accuracy << '\n'
+              << "confident: " << static_cast<double>(confident) / fields << '\n'
+              << "latency:   " << time.getTimeMicro() / fields << " us/field\n";
+    return accuracy < parser.get<double>("min-accuracy") ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h |      | print this message}"
+        "{@crops |      | directory with labelled field crops to evaluate}"
+        "{train  |      | directory with labelled field crops the glyph set is learned from}"
+        "{atlas  |      | glyph set directory, loaded when no training crops are given}"
+        "{save   |      | writes the learned glyph set to this directory}"
+        "{names  |      | crops are player names rather than amounts}"
+        "{min-accuracy | 0 | exit with failure when field accuracy drops below this}"};
+    if (parser.has("help") || !parser.has("@crops") || (!parser.has("train") && !parser.has("atlas"))) {
+        parser.printMessage();
+        return parser.has("help") ? 0 : 2;
+    }
+
+    try {
+        if (parser.has("names")) {
+            return evaluate(parser.has("atlas") ? oraker::TextReader::load(parser.get<std::string>("atlas"))
+                                                : oraker::TextReader{std::string{oraker::SeatNameReader::ALPHABET}, {}},
+                parser);
+        }
+        return evaluate(parser.has("atlas") ? oraker::AmountReader::load(parser.get<std::string>("atlas")) : oraker::AmountReader{{}}, parser);
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+}
@@ -0,0 +1,186 @@
+#include <oraker/detection_metrics.hpp>
+#include <oraker/detector.hpp>
+#include <oraker/tiled_detector.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <sstream>
+
+// Validates the in-process C++ detector on a Roboflow YOLOv8 export (data.yaml + <split>/images + <split>/labels),
+// the C++ counterpart of `yolo mode=val`. Exits with 1 when accuracy or latency regresses past the given thresholds.
+
+auto trim(std::string_view text) {
+    auto const first = text.find_first_not_of(" \t\r'\"");
+    auto const last = text.find_last_not_of(" \t\r'\"");
+    return first == std::string_view::npos ? std::string{} : std::string{text.substr(first, last - first + 1)};
+}
+
+// Reads `names` from data.yaml, either as a flow sequence (names: ['a', 'b']) or a block sequence (- a).
+auto readClassNames(std::filesystem::path const& dataYaml) {
+    auto file = std::ifstream{dataYaml};
+    if (!file) {
+        throw std::runtime_error("Failed to open " + dataYaml.string());
+    }
+
+    auto names = std::vector<std::string>{};
+    auto inNames = false;
+    for (std::string line; std::getline(file, line);) {
+        if (line.starts_with("names:")) {
+            auto const rest = std::string_view{line}.substr(6);
+            auto const open = rest.find('[');
+            if (open == std::string_view::npos) {
+                inNames = true;
+                continue;
+            }
+            auto items = std::istringstream{std::string{rest.substr(open + 1, rest.find(']') - open - 1)}};
+            for (std::string item; std::getline(items, item, ',');) {
+                names.push_back(trim(item));
+            }
+            break;
+        }
+        if (inNames) {
+            auto const content = trim(line);
+            if (!content.starts_with("- ")) {
+                break;
+            }
+            names.push_back(trim(std::string_view{content}.substr(2)));
+        }
+    }
+    return names;
+}
+
+// YOLO labels are "class cx cy w h" normalised to the image size; segmentation exports list polygon points instead.
+auto readLabels(std::filesystem::path const& path, cv::Size imageSize) {
+    auto truths = std::vector<oraker::GroundTruth>{};
+    auto file = std::ifstream{path};
+    for (std::string line; std::getline(file, line);) {
+        auto stream = std::istringstream{line};
+        auto classId = -1;
+        auto values = std::vector<float>{};
+        stream >> classId;
+        for (float value; stream >> value;) {
+            values.push_back(value);
+        }
+
+        auto box = cv::Rect2f{};
+        if (values.size() == 4) {
+            box = {values[0] - values[2] / 2, values[1] - values[3] / 2, values[2], values[3]};
+        } else if (values.size() >= 6 && values.size() % 2 == 0) {
+            auto minX = 1.0f, minY = 1.0f, maxX = 0.0f, maxY = 0.0f;
+            for (auto index = std::size_t{0}; index < values.size(); index += 2) {
+                minX = std::min(minX, values[index]);
+                maxX = std::max(maxX, values[index]);
+                minY = std::min(minY, values[index + 1]);
+                maxY = std::max(maxY, values[index + 1]);
+            }
+            box = {minX, minY, maxX - minX, maxY - minY};
+        } else {
+            continue;
+        }
+
+        auto const width = static_cast<float>(imageSize.width);
+        auto const height = static_cast<float>(imageSize.height);
+        truths.push_back({cv::Rect2f{box.x * width, box.y * height, box.width * width, box.height * height}, classId});
+    }
+    return truths;
+}
+
+auto percentile(std::vector<double> values, double fraction) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    auto const index = static_cast<std::size_t>(fraction * (values.size() - 1));
+    std::ranges::nth_element(values, values.begin() + index);
+    return values[index];
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h       |       | print this message}"
+        "{@dataset     |       | Roboflow YOLOv8 export directory containing data.yaml}"
+        "{model        |       | YOLOv8 ONNX model}"
+        "{split        | valid | dataset split to evaluate}"
+        "{regions      |       | table regions file, evaluates tiled inference when given}"
+        "{conf         | 0.001 | confidence threshold, low like yolo val so the PR curve is complete}"
+        "{min-map50    | 0     | fail when mAP50 drops below this value}"
+        "{min-map      | 0     | fail when mAP50-95 drops below this value}"
+        "{max-mean-ms  | 0     | fail when mean latency exceeds this value, 0 disables the check}"
+        "{max-p95-ms   | 0     | fail when 95th percentile latency exceeds this value, 0 disables the check}"};
+    if (parser.has("help") || !parser.has("@dataset") || !parser.has("model")) {
+        parser.printMessage();
+        return parser.has("help") ? 0 : 2;
+    }
+
+    auto const dataset = std::filesystem::path{parser.get<std::string>("@dataset")};
+    auto const split = parser.get<std::string>("split");
+    auto const classNames = readClassNames(dataset / "data.yaml");
+    if (classNames.empty()) {
+        std::cerr << "No class names found in " << dataset / "data.yaml" << '\n';
+        return 2;
+    }
+
+    auto detector = oraker::Detector{{.modelPath = parser.get<std::string>("model"), .confidenceThreshold = parser.get<float>("conf")}};
+    auto tiledDetector = std::optional<oraker::TiledDetector>{};
+    if (parser.has("regions")) {
+        tiledDetector.emplace(detector, oraker::loadRegions(parser.get<std::string>("regions")), oraker::TiledDetector::Options{});
+    }
+
+    auto metrics = oraker::DetectionMetrics{static_cast<int>(classNames.size())};
+    auto latencies = std::vector<double>{};
+    auto warmedUp = false;
+    for (auto const& entry : std::filesystem::directory_iterator{dataset / split / "images"}) {
+        auto const image = cv::imread(entry.path().string());
+        if (image.empty()) {
+            continue;
+        }
+        if (!warmedUp) {
+            tiledDetector ? tiledDetector->detect(image) : detector.detect(image);
+            warmedUp = true;
+        }
+
+        auto const started = std::chrono::steady_clock::now();
+        auto const predictions = tiledDetector ? tiledDetector->detect(image) : detector.detect(image);
+        latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count());
+
+        auto const labels = dataset / split / "labels" / entry.path().filename().replace_extension(".txt");
+        metrics.addImage(predictions, readLabels(labels, image.size()));
+    }
+    if (latencies.empty()) {
+        std::cerr << "No images found in " << dataset / split / "images" << '\n';
+        return 2;
+    }
+
+    auto const map50 = metrics.meanAveragePrecision50();
+    auto const map = metrics.meanAveragePrecision50To95();
+    auto const meanMs = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+    auto const p50Ms = percentile(latencies, 0.50);
+    auto const p95Ms = percentile(latencies, 0.95);
+    std::cout << "images:    " << latencies.size() << '\n'
+              << "mAP50:     " << map50 << '\n'
+              << "mAP50-95:  " << map << '\n'
+              << "latency:   mean " << meanMs << " ms, p50 " << p50Ms << " ms, p95 " << p95Ms << " ms\n";
+
+    auto regressions = std::vector<std::string>{};
+    if (map50 < parser.get<double>("min-map50")) {
+        regressions.push_back("mAP50 below " + parser.get<std::string>("min-map50"));
+    }
+    if (map < parser.get<double>("min-map")) {
+        regressions.push_back("mAP50-95 below " + parser.get<std::string>("min-map"));
+    }
+    if (auto const limit = parser.get<double>("max-mean-ms"); limit > 0 && meanMs > limit) {
+        regressions.push_back("mean latency above " + parser.get<std::string>("max-mean-ms") + " ms");
+    }
+    if (auto const limit = parser.get<double>("max-p95-ms"); limit > 0 && p95Ms > limit) {
+        regressions.push_back("p95 latency above " + parser.get<std::string>("max-p95-ms") + " ms");
+    }
+    for (auto const& regression : regressions) {
+        std::cerr << "Regression: " << regression << '\n';
+    }
+    return regressions.empty() ? 0 : 1;
+}
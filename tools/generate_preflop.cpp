@@ -0,0 +1,131 @@
+#include <oraker/equity.hpp>
+#include <oraker/preflop_table.hpp>
+#include <oraker/range_equity.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+// Generates the preflop equity table the runtime maps through PreflopTable. Ranges come from a text file
+// with one "<name> = <range>" line each, e.g. "utg-open = 77+, ATs+, KQs, AQo+". Class-vs-class matchups, which
+// the push/fold solver needs, take the longest; --matchup-boards=0 leaves them out.
+
+auto loadRanges(std::filesystem::path const& path) {
+    auto file = std::ifstream{path};
+    if (!file) {
+        throw std::runtime_error("Failed to open " + path.string());
+    }
+    auto ranges = std::vector<std::pair<std::string, oraker::Range>>{};
+    auto line = std::string{};
+    while (std::getline(file, line)) {
+        auto const equals = line.find('=');
+        if (line.find_first_not_of(" \t") == std::string::npos || line.starts_with('#')) {
+            continue;
+        }
+        if (equals == std::string::npos) {
+            throw std::runtime_error("Expected \"<name> = <range>\" in " + path.string() + ": " + line);
+        }
+        auto name = line.substr(0, equals);
+        name.erase(name.find_last_not_of(" \t") + 1);
+        name.erase(0, name.find_first_not_of(" \t"));
+        ranges.emplace_back(name, oraker::Range::parse(std::string_view{line}.substr(equals + 1)));
+    }
+    return ranges;
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h         |         | print this message}"
+        "{@output        |         | table file to write}"
+        "{opponents      | 9       | largest number of random opponents to tabulate}"
+        "{hands          | 1000000 | simulated hands per class and opponent count}"
+        "{ranges         |         | file of named villain ranges to tabulate heads-up}"
+        "{boards         | 100000  | sampled boards per class and range}"
+        "{matchup-boards | 16384   | sampled boards per pair of classes, 0 leaves out the class matchups}"
+        "{threads        | 0       | simulation threads, 0 uses every hardware thread}"
+        "{seed           | 1       | random seed}"};
+    if (parser.has("help") || !parser.has("@output")) {
+        parser.printMessage();
+        return parser.has("help") ? 0 : 2;
+    }
+
+    try {
+        auto const opponents = parser.get<int>("opponents");
+        auto const ranges = parser.has("ranges") ? loadRanges(parser.get<std::string>("ranges")) : std::vector<std::pair<std::string, oraker::Range>>{};
+        auto contents = oraker::PreflopTable::Contents{};
+        contents.hands = static_cast<std::uint64_t>(parser.get<double>("hands"));
+        contents.boards = static_cast<std::uint64_t>(parser.get<double>("boards"));
+
+        // Every entry runs on all threads; the seed gives the same table on any machine.
+        auto const simulation = oraker::MonteCarloEquity{{
+            .threads = parser.get<int>("threads"),
+            .seed = parser.get<unsigned>("seed"),
+            .confidenceWidth = 0.0,
+            .maxHands = contents.hands,
+        }};
+        // TickMeter only accumulates on stop(), so each report stops and restarts it.
+        auto time = cv::TickMeter{};
+        auto const elapsed = [&time] {
+            time.stop();
+            auto const seconds = time.getTimeSec();
+            time.start();
+            return seconds;
+        };
+        time.start();
+        for (auto count = 1; count <= opponents; ++count) {
+            for (auto handClass = 0; handClass < oraker::PreflopTable::CLASSES; ++handClass) {
+                auto const [first, second] = oraker::PreflopTable::representative(handClass);
+                auto const hole = std::array{first, second};
+                contents.random.push_back(static_cast<float>(simulation.estimate(hole, {}, count).equity));
+            }
+            std::cout << "against " << count << " random: " << elapsed() << " s\n";
+        }
+
+        auto const rangeEquity = oraker::RangeEquity{{
+            .threads = parser.get<int>("threads"),
+            .seed = parser.get<unsigned>("seed"),
+            .boards = static_cast<int>(contents.boards),
+        }};
+        for (auto const& [name, villain] : ranges) {
+            auto equities = std::vector<float>{};
+            for (auto handClass = 0; handClass < oraker::PreflopTable::CLASSES; ++handClass) {
+                auto const hero = oraker::Range::parse(oraker::PreflopTable::className(handClass));
+                equities.push_back(static_cast<float>(rangeEquity.evaluate(hero, villain, {}).equity));
+            }
+            contents.ranges.emplace_back(name, std::move(equities));
+            std::cout << "against " << name << ": " << elapsed() << " s\n";
+        }
+
+        // A class against itself splits evenly by symmetry, and each pair is evaluated once.
+        if (auto const matchupBoards = parser.get<int>("matchup-boards"); matchupBoards > 0) {
+            auto const matchupEquity = oraker::RangeEquity{{
+                .threads = parser.get<int>("threads"),
+                .seed = parser.get<unsigned>("seed"),
+                .boards = matchupBoards,
+            }};
+            auto const classes = static_cast<std::size_t>(oraker::PreflopTable::CLASSES);
+            contents.matchups.assign(classes * classes, 0.5f);
+            for (auto hero = std::size_t{0}; hero < classes; ++hero) {
+                auto const heroRange = oraker::Range::parse(oraker::PreflopTable::className(static_cast<int>(hero)));
+                for (auto villain = hero + 1; villain < classes; ++villain) {
+                    auto const villainRange = oraker::Range::parse(oraker::PreflopTable::className(static_cast<int>(villain)));
+                    auto const equity = matchupEquity.evaluate(heroRange, villainRange, {}).equity;
+                    contents.matchups[hero * classes + villain] = static_cast<float>(equity);
+                    contents.matchups[villain * classes + hero] = static_cast<float>(1.0 - equity);
+                }
+            }
+            std::cout << "class matchups: " << elapsed() << " s\n";
+        }
+
+        oraker::PreflopTable::write(parser.get<std::string>("@output"), contents);
+        auto const table = oraker::PreflopTable{parser.get<std::string>("@output")};
+        std::cout << "AA against one random hand: " << 100.0 * table.equity(oraker::Card{12, 0}, oraker::Card{12, 1}, 1) << "%\n";
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
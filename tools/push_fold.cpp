@@ -0,0 +1,139 @@
+#include <oraker/push_fold.hpp>
+#include <oraker/xoshiro.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Solves the push/fold equilibrium of a short-stacked spot from a preflop table generated with
+// --matchup-boards, e.g. "oraker-push-fold preflop.bin --stacks=12,8,15,10 --ante=0.1", and prints each
+// player's push chart and calling ranges. --payouts switches from chips to ICM. --spots times the solver
+// on random stacks for the same table instead.
+
+auto numbers(std::string const& text) {
+    auto values = std::vector<double>{};
+    auto items = std::istringstream{text};
+    for (std::string item; std::getline(items, item, ',');) {
+        try {
+            values.push_back(std::stod(item));
+        } catch (std::exception const&) {
+            throw std::runtime_error("Invalid number \"" + item + "\" in \"" + text + "\"");
+        }
+    }
+    return values;
+}
+
+auto playerName(int player, int players) -> std::string {
+    if (player == players - 1) {
+        return "BB";
+    }
+    if (player == players - 2) {
+        return "SB";
+    }
+    return "P" + std::to_string(player + 1);
+}
+
+// Percent of each class's combos played, pairs on the diagonal, suited hands above it.
+auto printChart(std::array<float, oraker::PreflopTable::CLASSES> const& strategy) {
+    auto const& ranks = oraker::Card::RANKS;
+    std::cout << "     ";
+    for (auto column = 12; column >= 0; --column) {
+        std::cout << std::setw(4) << ranks[static_cast<std::size_t>(column)];
+    }
+    std::cout << '\n';
+    for (auto row = 12; row >= 0; --row) {
+        std::cout << "    " << ranks[static_cast<std::size_t>(row)];
+        for (auto column = 12; column >= 0; --column) {
+            std::cout << std::setw(4) << static_cast<int>(100.0f * strategy[static_cast<std::size_t>(row * 13 + column)] + 0.5f);
+        }
+        std::cout << '\n';
+    }
+}
+
+auto report(oraker::PushFoldSolver const& solver, oraker::PushFoldSolver::Spot const& spot) {
+    auto const solution = solver.solve(spot);
+    auto const players = solution.players;
+    std::cout << players << " players, " << (spot.payouts.empty() ? "chip" : "ICM") << " payoffs: " << solution.iterations << " iterations, "
+              << (solution.converged ? "converged" : "not converged") << ", exploitability " << solution.exploitability << " bb, "
+              << solution.seconds * 1e3 << " ms\n";
+    for (auto pusher = 0; pusher + 1 < players; ++pusher) {
+        std::cout << '\n'
+                  << playerName(pusher, players) << " (" << spot.stacks[static_cast<std::size_t>(pusher)] << " bb) pushes "
+                  << 100.0 * solution.pushFrequency(pusher) << "% when folded to\n";
+        printChart(solution.push[static_cast<std::size_t>(pusher)]);
+        for (auto caller = pusher + 1; caller < players; ++caller) {
+            std::cout << "  " << playerName(caller, players) << " calls " << 100.0 * solution.callFrequency(caller, pusher) << "%:";
+            auto const& range = solution.callRange(caller, pusher);
+            for (auto handClass = oraker::PreflopTable::CLASSES - 1; handClass >= 0; --handClass) {
+                if (range[static_cast<std::size_t>(handClass)] >= 0.5f) {
+                    std::cout << ' ' << oraker::PreflopTable::className(handClass);
+                }
+            }
+            std::cout << '\n';
+        }
+    }
+    return solution.converged;
+}
+
+// Random stacks of 3 to 25 big blinds for as many players as the given spot, solved across threads.
+auto benchmark(oraker::PushFoldSolver const& solver, oraker::PushFoldSolver::Spot const& base, int count, unsigned seed) {
+    auto random = oraker::Xoshiro256{seed, 0};
+    auto spots = std::vector<oraker::PushFoldSolver::Spot>(static_cast<std::size_t>(count), base);
+    for (auto& spot : spots) {
+        for (auto& stack : spot.stacks) {
+            stack = 3.0 + 0.01 * random.below(2'201);
+        }
+    }
+    auto time = cv::TickMeter{};
+    time.start();
+    auto const solutions = solver.solve(spots);
+    time.stop();
+    auto const converged = std::ranges::count_if(solutions, [](auto const& solution) { return solution.converged; });
+    auto const slowest = std::ranges::max(solutions, {}, [](auto const& solution) { return solution.seconds; });
+    auto const worst = std::ranges::max(solutions, {}, [](auto const& solution) { return solution.exploitability; });
+    std::cout << count << " spots of " << base.stacks.size() << " players in " << time.getTimeSec() << " s, " << converged << " converged\n"
+              << "slowest:    " << slowest.seconds * 1e3 << " ms, " << slowest.iterations << " iterations\n"
+              << "worst:      " << worst.exploitability << " bb exploitability\n";
+    return converged == count;
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h      |                            | print this message}"
+        "{@table      |                            | preflop table written with --matchup-boards}"
+        "{stacks      | 10,10,10,10,10,10,10,10,10 | stacks in big blinds in order of action, big blind last}"
+        "{small-blind | 0.5                        | small blind in big blinds}"
+        "{ante        | 0                          | ante per player in big blinds}"
+        "{payouts     |                            | prize fractions from first place, e.g. 0.5,0.3,0.2; empty plays for chips}"
+        "{iterations  | 2000                       | most best response iterations}"
+        "{tolerance   | 0.001                      | exploitability in big blinds per hand to stop at}"
+        "{threads     | 0                          | threads solving spots in parallel, 0 uses every hardware thread}"
+        "{spots       | 0                          | times this many random stack configurations instead}"
+        "{seed        | 1                          | random stack seed}"};
+    if (parser.has("help") || !parser.has("@table")) {
+        parser.printMessage();
+        return parser.has("help") ? 0 : 2;
+    }
+
+    try {
+        auto const table = oraker::PreflopTable{parser.get<std::string>("@table")};
+        auto const solver = oraker::PushFoldSolver{table,
+            {.threads = parser.get<int>("threads"), .maxIterations = parser.get<int>("iterations"), .tolerance = parser.get<double>("tolerance")}};
+        auto const spot = oraker::PushFoldSolver::Spot{
+            .stacks = numbers(parser.get<std::string>("stacks")),
+            .smallBlind = parser.get<double>("small-blind"),
+            .ante = parser.get<double>("ante"),
+            .payouts = numbers(parser.get<std::string>("payouts")),
+        };
+        auto const passed = parser.get<int>("spots") > 0 ? benchmark(solver, spot, parser.get<int>("spots"), parser.get<unsigned>("seed")) : report(solver, spot);
+        return passed ? 0 : 1;
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 2;
+    }
+}
@@ -0,0 +1,167 @@
+#include <oraker/card_recognizer.hpp>
+#include <oraker/detection_tracker.hpp>
+#include <oraker/detector.hpp>
+#include <oraker/tiled_detector.hpp>
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <ranges>
+#include <regex>
+
+// Replays a captured session (assets/verN/<index>.png) through the recognition path and reports
+// how much work each fast path saves and what it costs in accuracy against full detection.
+
+auto listReplayFrames(std::filesystem::path const& directory) {
+    auto const matcher = std::regex{"^([0-9]+).png$"};
+    auto frames = std::vector<std::pair<std::size_t, std::filesystem::path>>{};
+    for (auto const& entry : std::filesystem::directory_iterator{directory}) {
+        auto const filename = entry.path().filename().string();
+        std::smatch match;
+        if (entry.is_regular_file() && std::regex_match(filename, match, matcher)) {
+            frames.emplace_back(static_cast<std::size_t>(std::stoul(match[1].str())), entry.path());
+        }
+    }
+    std::ranges::sort(frames);
+
+    auto paths = std::vector<std::filesystem::path>{};
+    std::ranges::copy(frames | std::views::values, std::back_inserter(paths));
+    return paths;
+}
+
+// Greedy same-class matching at IoU >= 0.5, returns the number of reference boxes recovered.
+auto countMatches(std::span<oraker::Detection const> predicted, std::span<oraker::Detection const> reference) {
+    auto used = std::vector<bool>(reference.size(), false);
+    auto matches = std::size_t{0};
+    for (auto const& detection : predicted) {
+        for (auto index = std::size_t{0}; index < reference.size(); ++index) {
+            if (!used[index] && reference[index].classId == detection.classId && oraker::intersectionOverUnion(reference[index].box, detection.box) >= 0.5f) {
+                used[index] = true;
+                ++matches;
+                break;
+            }
+        }
+    }
+    return matches;
+}
+
+auto ratio(std::size_t numerator, std::size_t denominator) {
+    return denominator == 0 ? 1.0 : static_cast<double>(numerator) / denominator;
+}
+
+int main(int argc, char** argv) {
+    auto const parser = cv::CommandLineParser{argc, argv,
+        "{help h     |      | print this message}"
+        "{@frames    |      | directory with captured <index>.png frames}"
+        "{model      |      | YOLOv8 ONNX model}"
+        "{regions    |      | table regions file, detection runs tiled when given}"
+        "{refresh    | 30   | tracker refresh interval in frames}"
+        "{threshold  | 6.0  | tracker mean absolute luma difference that counts as a change}"
+        "{names      |      | class names file, maps detector classes to cards}"
+        "{atlas      |      | glyph atlas directory, benchmarks template card reading against the detector}"
+        "{build-atlas|      | writes a glyph atlas learned from confidently detected cards to this directory}"};
+    if (parser.has("help") || !parser.has("@frames") || !parser.has("model")) {
+        parser.printMessage();
+        return parser.has("help") ? 0 : 1;
+    }
+
+    auto const frames = listReplayFrames(parser.get<std::string>("@frames"));
+    auto detector = oraker::Detector{{.modelPath = parser.get<std::string>("model")}};
+    auto tiledDetector = std::optional<oraker::TiledDetector>{};
+    if (parser.has("regions")) {
+        tiledDetector.emplace(detector, oraker::loadRegions(parser.get<std::string>("regions")), oraker::TiledDetector::Options{});
+    }
+    auto detect = [&](cv::Mat const& frame) {
+        return tiledDetector ? tiledDetector->detect(frame) : detector.detect(frame);
+    };
+
+    auto const classNames = parser.has("names") ? oraker::loadClassNames(parser.get<std::string>("names")) : std::vector<std::string>{};
+    auto cardOf = [&](oraker::Detection const& detection) {
+        return detection.classId >= 0 && detection.classId < static_cast<int>(classNames.size()) ? oraker::Card::parse(classNames[detection.classId]) : std::nullopt;
+    };
+    auto recognizer = parser.has("atlas") ? oraker::CardRecognizer::load(parser.get<std::string>("atlas")) : oraker::CardRecognizer{{}};
+    auto templateTime = cv::TickMeter{};
+    auto onnxTime = cv::TickMeter{};
+    auto cards = std::size_t{0};
+    auto templateHits = std::size_t{0};
+    auto templateCorrect = std::size_t{0};
+    auto onnxCorrect = std::size_t{0};
+    auto fallbackCorrect = std::size_t{0};
+
+    auto tracker = oraker::DetectionTracker{{.refreshInterval = parser.get<int>("refresh"), .changeThreshold = parser.get<double>("threshold")}};
+    auto detectionTime = cv::TickMeter{};
+    auto referenceBoxes = std::size_t{0};
+    auto trackedBoxes = std::size_t{0};
+    auto matchedBoxes = std::size_t{0};
+
+    for (auto const& path : frames) {
+        auto const frame = cv::imread(path.string());
+        if (frame.empty()) {
+            std::cerr << "Skipping unreadable frame " << path << '\n';
+            continue;
+        }
+
+        detectionTime.start();
+        auto const reference = detect(frame);
+        detectionTime.stop();
+
+        auto const tracked = tracker.process(frame, [&](auto const&) { return reference; });
+        referenceBoxes += reference.size();
+        trackedBoxes += tracked.size();
+        matchedBoxes += countMatches(tracked, reference);
+
+        // Card ROIs come from the full-frame detector, whose labels serve as the reference.
+        for (auto const& detection : reference) {
+            auto const card = cardOf(detection);
+            auto const area = cv::Rect{detection.box} & cv::Rect{cv::Point{}, frame.size()};
+            if (!card || area.empty()) {
+                continue;
+            }
+            auto const roi = frame(area);
+            if (parser.has("build-atlas")) {
+                if (detection.confidence >= 0.8f) {
+                    recognizer.learn(roi, *card);
+                }
+                continue;
+            }
+            if (!parser.has("atlas")) {
+                continue;
+            }
+
+            ++cards;
+            templateTime.start();
+            auto const recognized = recognizer.recognize(roi);
+            templateTime.stop();
+            onnxTime.start();
+            auto const detected = oraker::detectCard(detector, roi, classNames);
+            onnxTime.stop();
+
+            templateHits += recognized.card.has_value();
+            templateCorrect += recognized.card == card;
+            onnxCorrect += detected == card;
+            fallbackCorrect += (recognized.card ? recognized.card : detected) == card;
+        }
+    }
+
+    auto const& statistics = tracker.statistics();
+    auto const meanDetectionMs = detectionTime.getTimeMilli() / std::max<std::size_t>(statistics.frames, 1);
+    std::cout << "frames:            " << statistics.frames << '\n'
+              << "inference skipped: " << statistics.skipped << " (" << 100.0 * statistics.skippedFraction() << "%)\n"
+              << "detection:         " << meanDetectionMs << " ms/frame, " << meanDetectionMs * statistics.skipped << " ms saved\n"
+              << "tracked precision: " << ratio(matchedBoxes, trackedBoxes) << '\n'
+              << "tracked recall:    " << ratio(matchedBoxes, referenceBoxes) << '\n';
+
+    if (parser.has("build-atlas")) {
+        recognizer.save(parser.get<std::string>("build-atlas"));
+    }
+    if (cards > 0) {
+        std::cout << "card ROIs:         " << cards << '\n'
+                  << "template path:     " << templateTime.getTimeMicro() / cards << " us/card, confident on " << ratio(templateHits, cards) * 100.0
+                  << "%, accuracy when confident " << ratio(templateCorrect, templateHits) << '\n'
+                  << "onnx path:         " << onnxTime.getTimeMicro() / cards << " us/card, accuracy " << ratio(onnxCorrect, cards) << '\n'
+                  << "template+fallback: accuracy " << ratio(fallbackCorrect, cards) << '\n';
+    }
+    return 0;
+}